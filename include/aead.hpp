@@ -0,0 +1,42 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "handle_pool.hpp"
+
+namespace CryptoLib {
+
+    // AES-256-GCM (BCrypt); ključ se postavlja jednom i koristi za više poruka.
+    // Thread-safe: seal/open na istom objektu mogu se pozivati iz više niti. Key handle se
+    // ne deli (pravilo u handle_pool.hpp): svaka nit koja radi šifruje svojom kopijom
+    // ključa, pa deljen objekat skalira kao objekat po niti.
+    class Aes256Gcm {
+    public:
+        static constexpr std::size_t key_size = 32;
+        static constexpr std::size_t nonce_size = 12;
+        static constexpr std::size_t tag_size = 16;
+
+        explicit Aes256Gcm(const std::vector<std::uint8_t>& key);
+        ~Aes256Gcm();
+
+        Aes256Gcm(const Aes256Gcm&) = delete;
+        Aes256Gcm& operator=(const Aes256Gcm&) = delete;
+
+        // Vraća ciphertext || tag; nonce se nikada ne sme ponoviti sa istim ključem
+        std::vector<std::uint8_t> seal(const std::vector<std::uint8_t>& nonce,
+                                       const std::vector<std::uint8_t>& aad,
+                                       const std::vector<std::uint8_t>& plaintext) const;
+
+        // Baca std::runtime_error ako tag nije ispravan
+        std::vector<std::uint8_t> open(const std::vector<std::uint8_t>& nonce,
+                                       const std::vector<std::uint8_t>& aad,
+                                       const std::vector<std::uint8_t>& sealed) const;
+
+    private:
+        struct KeyHandle;
+
+        void* alg_ = nullptr; // BCRYPT_ALG_HANDLE
+        void* key_ = nullptr; // BCRYPT_KEY_HANDLE; samo izvor kopija, pod bravom pool-a
+        mutable HandlePool<KeyHandle> keys_; // kopije key_ za seal/open
+    };
+
+} // namespace CryptoLib
@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/multiprecision/cpp_int.hpp>
+
+namespace CryptoLib {
+
+    // Per-thread arena za privremene vrednosti u vrućim petljama (modexp, Miller-Rabin, egcd).
+    // Blokovi se uzimaju od sistema samo kada ponestane mesta; oslobođeni delovi idu u
+    // free-liste po klasama veličine (stepeni dvojke) i ponovo se koriste. Na kraju
+    // najspoljašnjeg ArenaScope-a sva memorija se briše (nule) i arena se resetuje.
+    // Svaka nit ima svoju arenu, pa nema zaključavanja; Arena::local() se ne prosleđuje
+    // drugoj niti.
+    class Arena {
+    public:
+        struct Stats {
+            std::size_t blocks = 0;              // blokova dobijenih od sistema
+            std::size_t reserved_bytes = 0;      // ukupna veličina blokova
+            std::size_t in_use_bytes = 0;        // trenutno dodeljeno
+            std::uint64_t system_allocations = 0; // ukupan broj poziva ka sistemskom alokatoru
+        };
+
+        static Arena& local();
+
+        void* allocate(std::size_t bytes);
+        void deallocate(void* p, std::size_t bytes) noexcept;
+
+        Stats stats() const;
+
+        ~Arena();
+
+    private:
+        friend class ArenaScope;
+
+        Arena() = default;
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        void reset() noexcept;
+
+        static constexpr std::size_t min_class = 6;      // 64 bajta
+        static constexpr std::size_t num_classes = 26;   // do 2^31 bajtova
+        static constexpr std::size_t block_size = 256 * 1024;
+
+        struct Block {
+            unsigned char* data;
+            std::size_t size;
+        };
+        struct FreeNode {
+            FreeNode* next;
+        };
+
+        std::vector<Block> blocks_;
+        std::size_t block_index_ = 0; // blok iz kog se trenutno seče
+        std::size_t offset_ = 0;      // pozicija u bloku block_index_
+        FreeNode* free_[num_classes] = {};
+        std::size_t in_use_ = 0;
+        unsigned depth_ = 0;
+        std::uint64_t system_allocations_ = 0;
+    };
+
+    // RAII opseg: ArenaBigInt vrednosti žive samo unutar njega. Opsezi mogu da se ugnežde;
+    // samo izlazak iz najspoljašnjeg briše i resetuje arenu tekuće niti.
+    class ArenaScope {
+    public:
+        ArenaScope();
+        ~ArenaScope();
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+    };
+
+    template <class T>
+    struct ArenaAllocator {
+        using value_type = T;
+
+        ArenaAllocator() noexcept = default;
+        template <class U>
+        ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+        T* allocate(std::size_t n) {
+            return static_cast<T*>(Arena::local().allocate(n * sizeof(T)));
+        }
+        void deallocate(T* p, std::size_t n) noexcept {
+            Arena::local().deallocate(p, n * sizeof(T));
+        }
+
+        template <class U>
+        bool operator==(const ArenaAllocator<U>&) const noexcept { return true; }
+        template <class U>
+        bool operator!=(const ArenaAllocator<U>&) const noexcept { return false; }
+    };
+
+    // cpp_int čiji limbovi žive u areni tekuće niti; ne sme da napusti ArenaScope ni nit
+    using ArenaBigInt = boost::multiprecision::number<boost::multiprecision::cpp_int_backend<
+        0, 0, boost::multiprecision::signed_magnitude, boost::multiprecision::unchecked,
+        ArenaAllocator<boost::multiprecision::limb_type>>>;
+
+} // namespace CryptoLib
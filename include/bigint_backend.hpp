@@ -0,0 +1,32 @@
+#pragma once
+#include <boost/multiprecision/cpp_int.hpp>
+#if defined(CRYPTOLIB_BIGINT_GMP)
+#include <boost/multiprecision/gmp.hpp>
+#endif
+
+namespace CryptoLib {
+
+    // Aritmetika iza BigInt tipa; bira se u vreme build-a (CMake opcija CRYPTOLIB_BIGINT_BACKEND):
+    //   cpp_int - Boost cpp_int na heap-u, modexp preko Montgomery kernela biblioteke (podrazumevano)
+    //   gmp     - Boost mpz_int nad libgmp, modexp preko mpz_powm_sec (konstantno vreme)
+    //   native  - cpp_int sa fiksnim brojem limbova na steku (bez alokacija), Montgomery kernel
+    //             kao kod cpp_int; vrednosti moraju stati u bigint_max_bits, pa RSA najviše 8192
+    // Interne vruće petlje (ArenaBigInt, Montgomery, Karatsuba) su uvek nad cpp_int limbovima.
+#if defined(CRYPTOLIB_BIGINT_GMP)
+    using BigInt = boost::multiprecision::mpz_int;
+    constexpr unsigned bigint_max_bits = 0; // 0 = bez ograničenja
+#elif defined(CRYPTOLIB_BIGINT_NATIVE)
+    // Proizvod dve 8192-bitne vrednosti plus rezerva za Barrett međurezultate
+    constexpr unsigned bigint_max_bits = 2 * 8192 + 256;
+    using BigInt = boost::multiprecision::number<boost::multiprecision::cpp_int_backend<
+        bigint_max_bits, bigint_max_bits, boost::multiprecision::signed_magnitude,
+        boost::multiprecision::unchecked, void>>;
+#else
+    using BigInt = boost::multiprecision::cpp_int;
+    constexpr unsigned bigint_max_bits = 0;
+#endif
+
+    // "cpp_int", "gmp" ili "native"; za izlaz benchmark-a
+    const char* bigint_backend_name();
+
+} // namespace CryptoLib
@@ -1,17 +1,37 @@
 #pragma once
 #include <vector>
 #include <cstdint>
-#include <boost/multiprecision/cpp_int.hpp>
+#include "bigint_backend.hpp"
+#include "arena.hpp"
 
 namespace CryptoLib {
 
-    using BigInt = boost::multiprecision::cpp_int;
-
+    // Funkcije nad BigInt su thread-safe za argumente koje druge niti samo čitaju
+    // (nijedan backend nema skriveno deljeno stanje); izbor algoritma čita globalna podešavanja
+    // (get_mont_kernel, get_mul_thresholds) atomski.
     BigInt modexp(const BigInt& base, const BigInt& exp, const BigInt& mod);
+    // result[i] = bases[i]^exps[i] mod mods[i]; exps i mods mogu imati jedan zajednički element.
+    // Neparni moduli idu kroz multi-buffer Montgomery (mont_modexp_batch), ostalo kroz modexp.
+    std::vector<BigInt> modexp_batch(const std::vector<BigInt>& bases, const std::vector<BigInt>& exps,
+                                     const std::vector<BigInt>& mods);
+    // g = gcd(|a|, |b|) >= 0 i a*x + b*y = g; iterativni Lehmer nad mašinskim rečima
+    // (GMP backend: mpz_gcdext)
     BigInt egcd(const BigInt& a, const BigInt& b, BigInt& x, BigInt& y);
+    // Baca std::runtime_error ako inverz ne postoji
     BigInt modinv(const BigInt& a, const BigInt& m);
+    // Inverzi svih vrednosti po istom modulu (Montgomery-jev trik): jedan modinv i 3(n-1)
+    // množenja umesto n inverza. Baca std::runtime_error ako bilo koja vrednost nema inverz.
+    std::vector<BigInt> modinv_batch(const std::vector<BigInt>& values, const BigInt& m);
+
+    // modexp nad ArenaBigInt za vruće petlje (Miller-Rabin); poziva se unutar ArenaScope-a.
+    // Parni moduli idu preko deljenja, bez Barrett puta.
+    ArenaBigInt modexp_arena(const ArenaBigInt& base, const ArenaBigInt& exp, const ArenaBigInt& mod);
 
     std::vector<std::uint8_t> bigint_to_bytes(const BigInt& x);
     BigInt bytes_to_bigint(const std::vector<std::uint8_t>& bytes);
 
+    // Briše sve limbove (i neiskorišćeni kapacitet) pre oslobađanja; x postaje 0.
+    // Menja x, pa nijedna druga nit ne sme da ga koristi u isto vreme.
+    void secure_wipe(BigInt& x);
+
 } // namespace CryptoLib
\ No newline at end of file
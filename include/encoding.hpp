@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace CryptoLib {
+
+    // Implementacije hex/base64 kodeka; izbor u runtime-u preko CPUID, kao za Montgomery
+    enum class CodecKernel {
+        Scalar, // tabele po bajtu
+        AVX2    // pshufb lookup, 32 bajta po iteraciji
+    };
+
+    bool codec_kernel_supported(CodecKernel kernel);
+    const char* codec_kernel_name(CodecKernel kernel);
+
+    // Podrazumevano najbrži podržan kernel. Kao i set_mont_kernel, globalno i atomski;
+    // sve funkcije kodeka su inače bez stanja i thread-safe.
+    CodecKernel get_codec_kernel();
+    void set_codec_kernel(CodecKernel kernel); // baca std::invalid_argument ako nije podržan
+
+    // ---- Hex (mala slova na izlazu; ulaz prihvata mala i velika slova) ----
+
+    constexpr std::size_t hex_encoded_size(std::size_t n) { return 2 * n; }
+    // Baca std::invalid_argument za neparnu dužinu
+    std::size_t hex_decoded_size(std::size_t len);
+
+    // out mora imati mesta za hex_encoded_size(n) znakova (bez završne nule)
+    void hex_encode(const std::uint8_t* in, std::size_t n, char* out);
+    // out mora imati mesta za hex_decoded_size(len) bajtova; vraća broj upisanih bajtova.
+    // Baca std::invalid_argument za neparnu dužinu ili znak koji nije hex cifra.
+    std::size_t hex_decode(const char* in, std::size_t len, std::uint8_t* out);
+
+    std::string hex_encode(const std::vector<std::uint8_t>& data);
+    std::vector<std::uint8_t> hex_decode(const std::string& hex);
+
+    // ---- Base64 (RFC 4648, standardna azbuka, obavezan '=' padding) ----
+
+    constexpr std::size_t base64_encoded_size(std::size_t n) { return (n + 2) / 3 * 4; }
+    // Tačna dužina posle dekodiranja (uzima u obzir padding); baca za dužinu koja nije deljiva sa 4
+    std::size_t base64_decoded_size(const char* in, std::size_t len);
+
+    void base64_encode(const std::uint8_t* in, std::size_t n, char* out);
+    // Strogo: bez razmaka i novih redova, '=' samo na kraju, neiskorišćeni bitovi moraju biti 0.
+    // Baca std::invalid_argument za neispravan ulaz.
+    std::size_t base64_decode(const char* in, std::size_t len, std::uint8_t* out);
+
+    std::string base64_encode(const std::vector<std::uint8_t>& data);
+    std::vector<std::uint8_t> base64_decode(const std::string& text);
+
+} // namespace CryptoLib
@@ -0,0 +1,76 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+namespace CryptoLib {
+
+    // Pravilo za BCrypt handle-ove u biblioteci: algorithm provider (BCRYPT_ALG_HANDLE) je
+    // thread-safe i deli se; key i hash handle-ovi (BCRYPT_KEY_HANDLE, BCRYPT_HASH_HANDLE)
+    // nisu, pa ih u istom trenutku koristi najviše jedna nit, ni za čitanje (BCryptDuplicate*).
+    //
+    // HandlePool drži kopije takvog stanja za objekat koji se deli između niti: nit uzme
+    // kopiju (Lease), radi nad njom bez brave i vrati je. Brava štiti samo listu slobodnih
+    // kopija; nova kopija se pravi pod bravom (make čita izvorni handle, koji tako koristi
+    // jedna nit), a ukupno ih ima koliko je najviše niti istovremeno radilo sa objektom.
+    // Kopije se uništavaju sa pool-om, tj. sa vlasnikom, a ne sa nitima.
+    template <class T>
+    class HandlePool {
+    public:
+        class Lease {
+        public:
+            Lease(HandlePool& pool, std::unique_ptr<T> item) : pool_(&pool), item_(std::move(item)) {}
+            ~Lease() { pool_->put(std::move(item_)); }
+
+            Lease(const Lease&) = delete;
+            Lease& operator=(const Lease&) = delete;
+
+            T& operator*() const { return *item_; }
+            T* operator->() const { return item_.get(); }
+
+        private:
+            HandlePool* pool_;
+            std::unique_ptr<T> item_;
+        };
+
+        HandlePool() = default;
+        HandlePool(const HandlePool&) = delete;
+        HandlePool& operator=(const HandlePool&) = delete;
+
+        // Slobodna kopija ili nova iz make() (std::unique_ptr<T>)
+        template <class Make>
+        Lease acquire(Make&& make) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (free_.empty()) {
+                // Kapacitet za sve kopije unapred, pa vraćanje u ~Lease ne alocira
+                free_.reserve(total_ + 1);
+                std::unique_ptr<T> item = make();
+                ++total_;
+                return Lease(*this, std::move(item));
+            }
+            std::unique_ptr<T> item = std::move(free_.back());
+            free_.pop_back();
+            return Lease(*this, std::move(item));
+        }
+
+        // Uništava sve kopije; vlasnik je poziva pre zatvaranja izvornog handle-a, kada nijedna
+        // nit više ne drži Lease
+        void clear() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_.clear();
+            total_ = 0;
+        }
+
+    private:
+        void put(std::unique_ptr<T> item) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_.push_back(std::move(item));
+        }
+
+        std::mutex mutex_;
+        std::vector<std::unique_ptr<T>> free_;
+        std::size_t total_ = 0;
+    };
+
+} // namespace CryptoLib
@@ -1,8 +1,69 @@
 #pragma once
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 
 namespace CryptoLib {
+    // sha256/sha384/sha512 su thread-safe: provider algoritma se otvara jednom i deli, a
+    // hash objekat se pravi po pozivu. HashContext drži svoj hash handle, koji po pravilu iz
+    // handle_pool.hpp u jednom trenutku koristi jedna nit.
+
     // SHA-256 hash, vraća 32 bajta
     std::vector<std::uint8_t> sha256(const std::vector<std::uint8_t>& data);
-}
\ No newline at end of file
+
+    // SHA-384 (48 bajtova) i SHA-512 (64 bajta); 64-bitne reči, na x64 bez SHA ekstenzija
+    // brže po bajtu od SHA-256
+    std::vector<std::uint8_t> sha384(const std::vector<std::uint8_t>& data);
+    std::vector<std::uint8_t> sha512(const std::vector<std::uint8_t>& data);
+
+    // Hash politike za OAEP/MGF1/potpis; dužina digest-a je poznata u vreme kompajliranja
+    struct Sha256 {
+        static constexpr std::size_t digest_size = 32;
+        static constexpr std::size_t block_size = 64;
+        static std::vector<std::uint8_t> hash(const std::vector<std::uint8_t>& data) { return sha256(data); }
+    };
+
+    struct Sha384 {
+        static constexpr std::size_t digest_size = 48;
+        static constexpr std::size_t block_size = 128;
+        static std::vector<std::uint8_t> hash(const std::vector<std::uint8_t>& data) { return sha384(data); }
+    };
+
+    struct Sha512 {
+        static constexpr std::size_t digest_size = 64;
+        static constexpr std::size_t block_size = 128;
+        static std::vector<std::uint8_t> hash(const std::vector<std::uint8_t>& data) { return sha512(data); }
+    };
+
+    // Inkrementalni hash za tokove i velike fajlove: update() proizvoljno puta, pa finish().
+    // Posle finish() kontekst je ponovo prazan i služi za sledeću poruku. Instancirano za
+    // Sha256, Sha384 i Sha512; jedan objekat koristi jedna nit.
+    template <class Hash>
+    class HashContext {
+    public:
+        HashContext();
+        ~HashContext();
+
+        HashContext(const HashContext&) = delete;
+        HashContext& operator=(const HashContext&) = delete;
+
+        void update(const std::uint8_t* data, std::size_t len);
+        void update(const std::vector<std::uint8_t>& data) { update(data.data(), data.size()); }
+
+        // Vraća Hash::digest_size bajtova i resetuje kontekst
+        std::vector<std::uint8_t> finish();
+        // Isto, upisuje Hash::digest_size bajtova u out (bez alokacije)
+        void finish(std::uint8_t* out);
+
+        // Preuzima trenutno stanje drugog konteksta (BCryptDuplicateHash): zajednički
+        // prefiks, npr. HMAC ključ, hešira se jednom, a svaka poruka kreće od te kopije.
+        // Kopiranje koristi handle izvora, pa ni izvor tada ne sme koristiti druga nit.
+        void assign(const HashContext& other);
+
+    private:
+        void* handle(); // pravi prazan hash objekat ako ga nema (posle finish)
+
+        std::vector<std::uint8_t> object_; // memorija BCrypt hash objekta
+        void* hash_ = nullptr;             // BCRYPT_HASH_HANDLE
+    };
+}
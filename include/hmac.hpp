@@ -0,0 +1,76 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "hash_utils.hpp"
+#include "handle_pool.hpp"
+
+namespace CryptoLib {
+
+    // HMAC (RFC 2104) nad hash politikom (Sha256, Sha384, Sha512) sa pripremljenim ključem:
+    // konstruktor jednom hešira blokove key^ipad i key^opad i čuva oba međustanja, pa MAC
+    // jedne poruke košta samo njene blokove plus jedan blok spoljnog hash-a.
+    // Thread-safe: isti ključ može deliti više niti. Hash handle-ovi se ne dele (pravilo u
+    // handle_pool.hpp), pa svaka nit koja računa MAC kopira međustanja iz svog para.
+    template <class Hash>
+    class Hmac {
+    public:
+        static constexpr std::size_t tag_size = Hash::digest_size;
+
+        // Ključ duži od bloka se prvo hešira; ključ se ne čuva, samo međustanja
+        explicit Hmac(const std::vector<std::uint8_t>& key);
+        Hmac(const std::uint8_t* key, std::size_t len);
+
+        Hmac(const Hmac&) = delete;
+        Hmac& operator=(const Hmac&) = delete;
+
+        std::vector<std::uint8_t> mac(const std::uint8_t* data, std::size_t len) const;
+        std::vector<std::uint8_t> mac(const std::vector<std::uint8_t>& data) const { return mac(data.data(), data.size()); }
+        // Upisuje tag_size bajtova u out
+        void mac(const std::uint8_t* data, std::size_t len, std::uint8_t* out) const;
+
+        // Poređenje u konstantnom vremenu; tag drugačije dužine nije ispravan
+        bool verify(const std::vector<std::uint8_t>& data, const std::vector<std::uint8_t>& tag) const;
+
+        // MAC za svaku poruku istim ključem: jedan kontekst, međustanja se kopiraju po
+        // poruci, a par za nit se uzima jednom za celu seriju. Druga varijanta piše tagove
+        // jedan za drugim u out (messages.size() * tag_size bajtova), bez alokacije po poruci.
+        std::vector<std::vector<std::uint8_t>> mac_batch(const std::vector<std::vector<std::uint8_t>>& messages) const;
+        void mac_batch(const std::vector<std::vector<std::uint8_t>>& messages, std::uint8_t* out) const;
+
+    private:
+        struct Midstates {
+            HashContext<Hash> inner; // posle key ^ ipad
+            HashContext<Hash> outer; // posle key ^ opad
+        };
+
+        // Kopija međustanja za ovu nit do kraja Lease-a; cela serija koristi jednu
+        typename HandlePool<Midstates>::Lease lease() const;
+        static void mac(const Midstates& mid, const std::uint8_t* data, std::size_t len, std::uint8_t* out);
+
+        Midstates keyed_;                     // izvor kopija, čita se samo pod bravom pool-a
+        mutable HandlePool<Midstates> copies_; // kopije keyed_ za mac()
+    };
+
+    using HmacSha256 = Hmac<Sha256>;
+
+    // Jednokratni HMAC-SHA-256; za više poruka istim ključem Hmac je brži
+    std::vector<std::uint8_t> hmac_sha256(const std::vector<std::uint8_t>& key, const std::vector<std::uint8_t>& data);
+
+    // HKDF (RFC 5869). Prazan salt znači Hash::digest_size nula. expand baca
+    // std::invalid_argument za length > 255 * Hash::digest_size; svi blokovi izlaza koriste
+    // isti pripremljeni PRK.
+    template <class Hash>
+    std::vector<std::uint8_t> hkdf_extract(const std::vector<std::uint8_t>& salt, const std::vector<std::uint8_t>& ikm);
+    template <class Hash>
+    std::vector<std::uint8_t> hkdf_expand(const std::vector<std::uint8_t>& prk, const std::vector<std::uint8_t>& info,
+                                          std::size_t length);
+    // extract + expand; međurezultat PRK se briše
+    template <class Hash>
+    std::vector<std::uint8_t> hkdf(const std::vector<std::uint8_t>& salt, const std::vector<std::uint8_t>& ikm,
+                                   const std::vector<std::uint8_t>& info, std::size_t length);
+
+    std::vector<std::uint8_t> hkdf_sha256(const std::vector<std::uint8_t>& salt, const std::vector<std::uint8_t>& ikm,
+                                          const std::vector<std::uint8_t>& info, std::size_t length);
+
+} // namespace CryptoLib
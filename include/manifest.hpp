@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "rsa.hpp"
+
+namespace CryptoLib {
+
+    // Potpisan manifest stabla direktorijuma: jedan SHA-256 po fajlu i jedan RSA potpis
+    // nad celim manifestom, umesto posebnog .sig fajla (i privatne operacije) po fajlu.
+    //
+    // Format (UTF-8 tekst, redovi sortirani po putanji, bajt po bajt):
+    //   CryptoLib-Manifest v1 sha256
+    //   <veličina> <sha256 hex> <relativna putanja sa '/'>
+    // Putanja je poslednja u redu pa sme da sadrži razmake, ali ne i novi red.
+
+    struct ManifestEntry {
+        std::string path;               // relativno u odnosu na koren, separator '/'
+        std::uint64_t size = 0;
+        std::vector<std::uint8_t> digest; // SHA-256
+    };
+
+    struct SignedManifest {
+        std::string text;
+        std::vector<std::uint8_t> signature; // RSA::sign<Sha256> nad text
+    };
+
+    struct ManifestReport {
+        bool signature_ok = false;
+        std::vector<std::string> modified; // drugačija veličina ili sadržaj
+        std::vector<std::string> missing;  // u manifestu, ali ne i na disku
+        std::vector<std::string> added;    // na disku, ali ne i u manifestu
+
+        bool ok() const { return signature_ok && modified.empty() && missing.empty() && added.empty(); }
+    };
+
+    // Rekurzivno prolazi kroz root (samo regularni fajlovi, simbolički linkovi se ne prate)
+    // i hešira fajlove paralelno na `threads` niti (0 = broj jezgara), čitajući ih u
+    // blokovima. Vraća stavke sortirane po putanji. Baca std::runtime_error ako neki fajl
+    // ne može da se pročita.
+    std::vector<ManifestEntry> build_manifest(const std::string& root, unsigned threads = 0);
+
+    std::string serialize_manifest(const std::vector<ManifestEntry>& entries);
+    // Baca std::invalid_argument za neispravan ili nesortiran manifest
+    std::vector<ManifestEntry> parse_manifest(const std::string& text);
+
+    // build_manifest + jedna privatna RSA operacija nad serijalizovanim manifestom
+    SignedManifest sign_directory(const std::string& root, const PrivateKey& priv, unsigned threads = 0);
+
+    // Proverava potpis, pa paralelno ponovo hešira stablo i poredi ga sa manifestom.
+    // Ako potpis nije ispravan, sadržaju manifesta se ne veruje i poređenje se preskače.
+    ManifestReport verify_directory(const std::string& root, const SignedManifest& manifest,
+                                    const PublicKey& pub, unsigned threads = 0);
+
+} // namespace CryptoLib
@@ -0,0 +1,53 @@
+#pragma once
+#include "bigint_utils.hpp"
+#include <vector>
+
+namespace CryptoLib {
+
+    // Implementacije Montgomery množenja; None znači da modexp ne koristi Montgomery
+    enum class MontKernel {
+        None,
+        Scalar, // pune mašinske reči, CIOS
+        AVX2,   // redundantne 29-bitne cifre, 4 po ymm registru
+        IFMA    // redundantne 52-bitne cifre, 8 po zmm registru (AVX-512 IFMA)
+    };
+
+    // Da li su kernel ugrađen u biblioteku i podržan od strane CPU-a (CPUID)
+    bool mont_kernel_supported(MontKernel kernel);
+
+    // Najbrži podržan kernel na ovom CPU-u
+    MontKernel detect_mont_kernel();
+
+    const char* mont_kernel_name(MontKernel kernel);
+
+    // Kernel koji modexp koristi za neparne module; podrazumevano detect_mont_kernel().
+    // Globalno podešavanje u atomskoj promenljivoj: bezbedno iz bilo koje niti, a važi za
+    // pozive koji počnu posle promene (modexp koji je u toku završava sa starim kernelom).
+    MontKernel get_mont_kernel();
+    void set_mont_kernel(MontKernel kernel);
+
+    // base^exp mod mod preko Montgomery množenja sa fiksnim prozorom; mod mora biti neparan.
+    // Niz množenja i pristupa tabeli zavisi samo od dužine exp, ne od njegovih bitova.
+    // Thread-safe; kontekst i tabela prozora se prave po pozivu u areni tekuće niti.
+    BigInt mont_modexp(const BigInt& base, const BigInt& exp, const BigInt& mod);
+    BigInt mont_modexp(const BigInt& base, const BigInt& exp, const BigInt& mod, MontKernel kernel);
+
+    // Isto nad ArenaBigInt, za vruće petlje; poziva se unutar ArenaScope-a
+    ArenaBigInt mont_modexp_arena(const ArenaBigInt& base, const ArenaBigInt& exp, const ArenaBigInt& mod);
+
+    // Multi-buffer eksponenciranje: nezavisni ulazi se grupišu po mont_batch_lanes() i
+    // računaju u koraku, svaki u svojoj traci vektora (IFMA: 8, AVX2: 4 traka), sa svojim
+    // modulom i eksponentom. Namenjeno serijama privatnih operacija i Miller-Rabin svedocima.
+    // Traka košta koliko i najduži eksponent u grupi, pa se isplati za ulaze slične veličine.
+    std::size_t mont_batch_lanes(); // 1 = multi-buffer nije dostupan, ulazi se rade redom
+
+    // result[i] = bases[i]^exps[i] mod mods[i]; exps i mods mogu imati jedan element koji važi
+    // za sve. Ulazi koje kernel ne pokriva idu kroz mont_modexp, sa istim izuzecima.
+    std::vector<BigInt> mont_modexp_batch(const std::vector<BigInt>& bases, const std::vector<BigInt>& exps,
+                                          const std::vector<BigInt>& mods);
+
+    // out[i] = bases[i]^exp mod mod nad ArenaBigInt (Miller-Rabin); unutar ArenaScope-a
+    void mont_modexp_batch_arena(const ArenaBigInt* bases, const ArenaBigInt& exp, const ArenaBigInt& mod,
+                                 ArenaBigInt* out, std::size_t count);
+
+} // namespace CryptoLib
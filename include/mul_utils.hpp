@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include "bigint_utils.hpp"
+
+namespace CryptoLib {
+
+    // Pragovi (u limbovima) iznad kojih se koristi Karatsuba množenje/kvadriranje,
+    // odnosno Barrett redukcija u modexp umesto deljenja
+    struct MulThresholds {
+        std::size_t karatsuba_mul = 32;
+        std::size_t karatsuba_sqr = 48;
+        std::size_t barrett = 8;
+    };
+
+    // Globalni pragovi; svako polje je posebna atomska promenljiva. set iz jedne niti dok
+    // druge množe je bezbedan: poziv u toku može da vidi mešavinu starih i novih pragova,
+    // a svaka kombinacija daje isti (tačan) rezultat, samo drugim putem.
+    MulThresholds get_mul_thresholds();
+    void set_mul_thresholds(const MulThresholds& t);
+
+    // Broj limbova (mašinskih reči) u apsolutnoj vrednosti x
+    std::size_t limb_count(const BigInt& x);
+
+    // a * b i a * a za nenegativne brojeve; Karatsuba iznad praga, školski ispod
+    BigInt mul(const BigInt& a, const BigInt& b);
+    BigInt sqr(const BigInt& a);
+
+    // Barrett redukcija za fiksni modul: mu = floor(B^(2k) / m), B = 2^limb_bits.
+    // Posle konstrukcije nepromenljiv; isti objekat mogu da koriste sve niti.
+    class BarrettReducer {
+    public:
+        explicit BarrettReducer(const BigInt& m);
+
+        // x mod m za 0 <= x < m^2
+        BigInt reduce(const BigInt& x) const;
+
+    private:
+        BigInt m_;
+        BigInt mu_;
+        unsigned k_; // broj limbova modula
+    };
+
+} // namespace CryptoLib
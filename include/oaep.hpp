@@ -2,14 +2,27 @@
 #include <vector>
 #include <cstdint>
 #include <string>
+#include "hash_utils.hpp"
 
 namespace CryptoLib {
 
+    // Čiste funkcije bez stanja; thread-safe.
+
+    // MGF1 nad hash politikom; instancirano za Sha256, Sha384 i Sha512
+    template <class Hash>
+    std::vector<std::uint8_t> mgf1(const std::vector<std::uint8_t>& seed, std::size_t len);
+
+    // OAEP encode/decode sa prazan label (""), po RFC 3447; hash je i za lHash i za MGF1.
+    // k = dužina modula u bajtovima, poruka najviše k - 2*digest_size - 2 bajtova
+    template <class Hash>
+    std::vector<std::uint8_t> oaep_encode(const std::vector<std::uint8_t>& msg, std::size_t k);
+    template <class Hash>
+    std::vector<std::uint8_t> oaep_decode(const std::vector<std::uint8_t>& em, std::size_t k);
+
     // MGF1 sa SHA-256
     std::vector<std::uint8_t> mgf1_sha256(const std::vector<std::uint8_t>& seed, std::size_t len);
 
-    // OAEP encode/decode sa SHA-256 i prazan label (""), po RFC 3447
-    // k = dužina modula u bajtovima
+    // OAEP encode/decode sa SHA-256 (isto što i oaep_encode<Sha256>)
     std::vector<std::uint8_t> oaep_encode(const std::vector<std::uint8_t>& msg, std::size_t k);
     std::vector<std::uint8_t> oaep_decode(const std::vector<std::uint8_t>& em, std::size_t k);
 
@@ -0,0 +1,83 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bigint_utils.hpp"
+
+namespace CryptoLib {
+
+    struct PrimePoolConfig {
+        std::vector<int> prime_bits = { 1024 }; // veličine prostih brojeva (RSA-2048 -> 1024)
+        std::size_t low_watermark = 2;          // ispod ovoga niti kreću sa dopunom
+        std::size_t high_watermark = 8;         // dopuna ide do ovoga (ujedno i kapacitet)
+        unsigned threads = 1;                   // pozadinske niti niskog prioriteta
+
+        // Opciono šifrovano čuvanje (AES-256-GCM) između pokretanja; prazna putanja = isključeno.
+        // Fajl se briše odmah pri učitavanju da se isti prost broj nikada ne bi iskoristio dvaput.
+        std::string persist_path;
+        std::vector<std::uint8_t> persist_key; // 32 bajta
+    };
+
+    struct PrimePoolStats {
+        std::size_t available = 0;  // trenutno na stanju
+        std::uint64_t hits = 0;     // take() poslužen iz pool-a
+        std::uint64_t misses = 0;   // take() morao da generiše sinhrono
+        std::uint64_t generated = 0; // generisano u pozadini
+        std::uint64_t loaded = 0;   // učitano iz sačuvanog fajla
+    };
+
+    // Ograničen, thread-safe skup unapred generisanih prostih brojeva
+    class PrimePool {
+    public:
+        explicit PrimePool(const PrimePoolConfig& config);
+        ~PrimePool(); // zaustavlja niti, čuva stanje ako je podešeno i briše preostale brojeve
+
+        PrimePool(const PrimePool&) = delete;
+        PrimePool& operator=(const PrimePool&) = delete;
+
+        // Uzima prost broj iz pool-a; slot se briše. false ako nema na stanju.
+        bool try_take(int bits, BigInt& out);
+
+        // Kao try_take, ali sinhrono generiše prost broj kada pool nema stanja
+        BigInt take(int bits);
+
+        PrimePoolStats stats(int bits) const;
+
+        // Zaustavlja pozadinske niti i (ako je podešeno) čuva preostale brojeve u fajl
+        void stop();
+
+    private:
+        struct Bucket {
+            std::deque<BigInt> primes;
+            std::size_t in_flight = 0;
+            bool refilling = true; // na početku se puni do high_watermark
+            PrimePoolStats stats;
+        };
+
+        void worker();
+        int next_job(); // veličina koju treba dopuniti, 0 ako nema posla
+        void load();
+        void save();
+
+        PrimePoolConfig config_;
+        mutable std::mutex mutex_;
+        std::condition_variable cv_;
+        std::map<int, Bucket> buckets_;
+        std::vector<std::thread> threads_;
+        std::atomic<bool> stopping_{ false };
+        bool stopped_ = false;
+    };
+
+    // Pool iz kog RSA::generate_keys uzima p i q; nullptr = generisanje na zahtev.
+    // Thread-safe; generate_keys koji je u toku zadržava pool koji je uzeo (shared_ptr).
+    void set_prime_pool(std::shared_ptr<PrimePool> pool);
+    std::shared_ptr<PrimePool> get_prime_pool();
+
+} // namespace CryptoLib
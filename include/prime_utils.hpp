@@ -1,9 +1,10 @@
 #pragma once
-#include <boost/multiprecision/cpp_int.hpp>
 #include <cstdint>
+#include "bigint_backend.hpp"
 
 namespace CryptoLib {
-    using BigInt = boost::multiprecision::cpp_int;
+
+    // Thread-safe; privremene vrednosti i bafer za slučajne bajtove su po niti.
 
     // Generiše slučajan veliki broj sa zadatim brojem bitova
     BigInt random_bigint_bits(int bits);
@@ -3,6 +3,7 @@
 #include <cstdint>
 
 namespace CryptoLib {
-    // Popuni bafer kriptografski sigurnim random bajtovima
+    // Popuni bafer kriptografski sigurnim random bajtovima. Thread-safe: sistemski RNG
+    // (BCRYPT_USE_SYSTEM_PREFERRED_RNG) bez handle-a koji bi se delio između niti.
     void csprng_bytes(std::vector<std::uint8_t>& buf);
 }
\ No newline at end of file
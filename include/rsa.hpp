@@ -3,6 +3,7 @@
 #include <string>
 #include <cstdint>
 #include "bigint_utils.hpp"
+#include "hash_utils.hpp"
 
 namespace CryptoLib {
 
@@ -14,6 +15,7 @@ namespace CryptoLib {
     struct PrivateKey {
         BigInt n;
         BigInt d;
+        BigInt e; // javni eksponent, za jeftino obnavljanje blinding para; 0 = nepoznat
     };
 
     struct RSAKeyPair {
@@ -21,8 +23,12 @@ namespace CryptoLib {
         PrivateKey private_key;
     };
 
+    // Sve funkcije su thread-safe i bez deljenog stanja: isti PublicKey/PrivateKey može
+    // istovremeno da koristi više niti (ključ se samo čita), a privremene vrednosti i
+    // blinding parovi su po niti. Ključ se ne sme menjati ni brisati dok je u upotrebi.
     class RSA {
     public:
+        // Uzima p i q iz get_prime_pool() ako je postavljen (PrimePool je thread-safe)
         static RSAKeyPair generate_keys(int bits);
 
         static std::vector<std::uint8_t> encrypt(const std::vector<std::uint8_t>& plaintext,
@@ -30,16 +36,59 @@ namespace CryptoLib {
         static std::vector<std::uint8_t> decrypt(const std::vector<std::uint8_t>& ciphertext,
                                                  const PrivateKey& priv);
 
+        // Serija dešifrovanja istim ključem: stepenovanja idu zajedno kroz multi-buffer
+        // modexp_batch (mont_batch_lanes() po prolazu), što po operaciji košta višestruko
+        // manje od pojedinačnih poziva. Rezultat je isti kao decrypt za svaki element.
+        static std::vector<std::vector<std::uint8_t>> decrypt_batch(
+            const std::vector<std::vector<std::uint8_t>>& ciphertexts, const PrivateKey& priv);
+
         static std::vector<std::uint8_t> encrypt_string(const std::string& plaintext,
                                                         const PublicKey& pub);
         static std::string decrypt_to_string(const std::vector<std::uint8_t>& ciphertext,
                                              const PrivateKey& priv);
 
+        // OAEP sa izabranim hash-om (Sha256, Sha384, Sha512); bez parametra je SHA-256
+        template <class Hash>
+        static std::vector<std::uint8_t> encrypt_string(const std::string& plaintext,
+                                                        const PublicKey& pub);
+        template <class Hash>
+        static std::string decrypt_to_string(const std::vector<std::uint8_t>& ciphertext,
+                                             const PrivateKey& priv);
+
+        // Blinding privatnih operacija (decrypt, sign, decrypt_to_string): ulaz se pre
+        // stepenovanja sa d množi slučajnim r^e, pa vreme ne zavisi od ulaza. Par (r^e, r^-1)
+        // se čuva po ključu i niti, posle svake upotrebe kvadrira, a povremeno pravi iznova.
+        // Serije (decrypt_batch, sign_batch) uz poznat e dobijaju svež par po elementu.
+        // Podrazumevano uključeno; isključivanje je globalno (atomski), samo za merenja.
+        // Keš ne čuva d, već otisak (n, e, d). Kada ključ uđe u keš niti proverava se da e
+        // odgovara d; ako ne odgovara, privatna operacija baca std::invalid_argument.
+        static void set_blinding(bool enabled);
+        static bool blinding_enabled();
+
+        // Briše blinding parove: u tekućoj niti odmah, u ostalim nitima pri njihovoj sledećoj
+        // privatnoj operaciji (ili izlasku iz niti). Za pozivaoca koji briše ili menja ključ.
+        static void clear_blinding_cache();
+
         // ➕ Digitalni potpis i verifikacija
         static std::vector<std::uint8_t> sign(const std::string& message, const PrivateKey& priv);
         static bool verify(const std::string& message,
                            const std::vector<std::uint8_t>& signature,
                            const PublicKey& pub);
+
+        // Serija potpisa istim ključem, kao decrypt_batch; isti rezultat kao sign po poruci
+        static std::vector<std::vector<std::uint8_t>> sign_batch(const std::vector<std::string>& messages,
+                                                                 const PrivateKey& priv);
+
+        // Potpis nad izabranim hash-om (Sha256, Sha384, Sha512)
+        template <class Hash>
+        static std::vector<std::uint8_t> sign(const std::string& message, const PrivateKey& priv);
+        template <class Hash>
+        static std::vector<std::vector<std::uint8_t>> sign_batch(const std::vector<std::string>& messages,
+                                                                 const PrivateKey& priv);
+        template <class Hash>
+        static bool verify(const std::string& message,
+                           const std::vector<std::uint8_t>& signature,
+                           const PublicKey& pub);
     };
 
 } // namespace CryptoLib
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "rsa.hpp"
+#include "aead.hpp"
+
+namespace CryptoLib {
+
+    // Ograničenja po ključu sesije; posle njih pošiljalac mora da uradi rekey().
+    // 2^24 poruka prati preporuku TLS 1.3 za AES-GCM (RFC 8446, 5.5).
+    struct SessionLimits {
+        std::uint64_t max_messages = std::uint64_t(1) << 24;
+        std::uint64_t max_bytes = std::uint64_t(1) << 36; // 64 GiB plaintext-a
+    };
+
+    // Format:
+    //   encapsulated_key = RSA-OAEP(ključ (32) || epoha u32)
+    //   poruka           = epoha u32 || brojač u64 || AES-256-GCM(ciphertext || tag)
+    // Zaglavlje od 12 bajtova je ujedno i GCM nonce; brojač kreće od 0 u svakoj epohi
+    // i nikada se ne ponavlja sa istim ključem.
+    constexpr std::size_t session_header_size = 12;
+
+    // Pošiljalac: jedna RSA operacija po ključu sesije, zatim proizvoljno mnogo poruka
+    // proizvoljne dužine. Nije thread-safe (brojač poruka): više niti koje šalju deli jedan
+    // objekat samo uz spoljno zaključavanje, ili svaka nit otvara svoju sesiju.
+    class SessionSender {
+    public:
+        explicit SessionSender(const PublicKey& recipient, const SessionLimits& limits = SessionLimits{});
+
+        // Šalje se primaocu pre prvih poruka i posle svakog rekey()
+        const std::vector<std::uint8_t>& encapsulated_key() const { return encapsulated_; }
+
+        // Baca std::runtime_error kada su ograničenja ključa iscrpljena (potreban rekey)
+        std::vector<std::uint8_t> seal(const std::vector<std::uint8_t>& plaintext,
+                                       const std::vector<std::uint8_t>& aad = {});
+        std::vector<std::uint8_t> seal_string(const std::string& plaintext);
+
+        // Novi ključ sesije i nova epoha; vraća novi encapsulated_key
+        const std::vector<std::uint8_t>& rekey();
+
+        // Da li sledeća poruka od `bytes` bajtova prelazi ograničenja
+        bool needs_rekey(std::size_t bytes = 0) const;
+
+        std::uint32_t epoch() const { return epoch_; }
+        std::uint64_t messages_sealed() const { return messages_; }
+
+    private:
+        PublicKey recipient_;
+        SessionLimits limits_;
+        std::unique_ptr<Aes256Gcm> aead_;
+        std::vector<std::uint8_t> encapsulated_;
+        std::uint32_t epoch_ = 0;
+        std::uint64_t messages_ = 0;
+        std::uint64_t bytes_ = 0;
+    };
+
+    // Primalac: prihvata samo poruke tekuće epohe sa strogo rastućim brojačem
+    // (ponovljene i zakasnele poruke se odbijaju, izgubljene se preskaču). Nije thread-safe.
+    class SessionReceiver {
+    public:
+        SessionReceiver(const PrivateKey& priv, const std::vector<std::uint8_t>& encapsulated_key,
+                        const SessionLimits& limits = SessionLimits{});
+
+        // Baca std::runtime_error za pogrešnu epohu, ponovljen brojač ili neispravan tag
+        std::vector<std::uint8_t> open(const std::vector<std::uint8_t>& sealed,
+                                       const std::vector<std::uint8_t>& aad = {});
+        std::string open_string(const std::vector<std::uint8_t>& sealed);
+
+        // Prelazi na ključ iz novog encapsulated_key (epoha mora da raste)
+        void rekey(const std::vector<std::uint8_t>& encapsulated_key);
+
+        std::uint32_t epoch() const { return epoch_; }
+
+    private:
+        PrivateKey priv_;
+        SessionLimits limits_;
+        std::unique_ptr<Aes256Gcm> aead_;
+        std::uint32_t epoch_ = 0;
+        bool have_key_ = false;
+        std::uint64_t next_counter_ = 0;
+        std::uint64_t bytes_ = 0;
+    };
+
+} // namespace CryptoLib
@@ -1,6 +1,15 @@
 #pragma once
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
 
 namespace CryptoLib {
+    // Thread-safe (bez stanja)
     std::string to_hex(const std::string& input);
+
+    // Briše bafer tako da kompajler ne može da izostavi upis; dužina ostaje ista.
+    // Ne sme se pozivati dok druga nit čita buf.
+    void secure_wipe(std::vector<std::uint8_t>& buf);
+    void secure_wipe(std::uint8_t* buf, std::size_t len);
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "aead.hpp"
+#include <stdexcept>
+#include <memory>
+#include <windows.h>
+#include <bcrypt.h>
+
+#pragma comment(lib, "bcrypt.lib")
+
+namespace CryptoLib {
+
+    static const NTSTATUS status_auth_tag_mismatch = static_cast<NTSTATUS>(0xC000A002L);
+
+    // Kopija ključa koju u jednom trenutku koristi jedna nit
+    struct Aes256Gcm::KeyHandle {
+        BCRYPT_KEY_HANDLE key = nullptr;
+
+        explicit KeyHandle(BCRYPT_KEY_HANDLE source) {
+            NTSTATUS status = BCryptDuplicateKey(source, &key, nullptr, 0, 0);
+            if (status != 0) throw std::runtime_error("BCryptDuplicateKey failed");
+        }
+        ~KeyHandle() { BCryptDestroyKey(key); }
+
+        KeyHandle(const KeyHandle&) = delete;
+        KeyHandle& operator=(const KeyHandle&) = delete;
+    };
+
+    Aes256Gcm::Aes256Gcm(const std::vector<std::uint8_t>& key) {
+        if (key.size() != key_size) throw std::invalid_argument("Aes256Gcm: key must be 32 bytes");
+
+        BCRYPT_ALG_HANDLE hAlg = nullptr;
+        NTSTATUS status = BCryptOpenAlgorithmProvider(&hAlg, BCRYPT_AES_ALGORITHM, nullptr, 0);
+        if (status != 0) throw std::runtime_error("BCryptOpenAlgorithmProvider AES failed");
+
+        status = BCryptSetProperty(hAlg, BCRYPT_CHAINING_MODE, (PUCHAR)BCRYPT_CHAIN_MODE_GCM,
+                                   sizeof(BCRYPT_CHAIN_MODE_GCM), 0);
+        if (status != 0) { BCryptCloseAlgorithmProvider(hAlg, 0); throw std::runtime_error("BCryptSetProperty GCM failed"); }
+
+        BCRYPT_KEY_HANDLE hKey = nullptr;
+        status = BCryptGenerateSymmetricKey(hAlg, &hKey, nullptr, 0, const_cast<PUCHAR>(key.data()),
+                                            static_cast<ULONG>(key.size()), 0);
+        if (status != 0) { BCryptCloseAlgorithmProvider(hAlg, 0); throw std::runtime_error("BCryptGenerateSymmetricKey failed"); }
+
+        alg_ = hAlg;
+        key_ = hKey;
+    }
+
+    Aes256Gcm::~Aes256Gcm() {
+        keys_.clear();
+        if (key_) BCryptDestroyKey(static_cast<BCRYPT_KEY_HANDLE>(key_));
+        if (alg_) BCryptCloseAlgorithmProvider(static_cast<BCRYPT_ALG_HANDLE>(alg_), 0);
+    }
+
+    std::vector<std::uint8_t> Aes256Gcm::seal(const std::vector<std::uint8_t>& nonce,
+                                              const std::vector<std::uint8_t>& aad,
+                                              const std::vector<std::uint8_t>& plaintext) const {
+        if (nonce.size() != nonce_size) throw std::invalid_argument("Aes256Gcm::seal: nonce must be 12 bytes");
+
+        std::vector<std::uint8_t> out(plaintext.size() + tag_size);
+        BCRYPT_AUTHENTICATED_CIPHER_MODE_INFO info;
+        BCRYPT_INIT_AUTH_MODE_INFO(info);
+        info.pbNonce = const_cast<PUCHAR>(nonce.data());
+        info.cbNonce = static_cast<ULONG>(nonce.size());
+        info.pbAuthData = aad.empty() ? nullptr : const_cast<PUCHAR>(aad.data());
+        info.cbAuthData = static_cast<ULONG>(aad.size());
+        info.pbTag = out.data() + plaintext.size();
+        info.cbTag = static_cast<ULONG>(tag_size);
+
+        ULONG written = 0;
+        auto key = keys_.acquire([this] { return std::make_unique<KeyHandle>(static_cast<BCRYPT_KEY_HANDLE>(key_)); });
+        NTSTATUS status = BCryptEncrypt(key->key,
+                                        plaintext.empty() ? nullptr : const_cast<PUCHAR>(plaintext.data()),
+                                        static_cast<ULONG>(plaintext.size()), &info, nullptr, 0,
+                                        plaintext.empty() ? nullptr : out.data(),
+                                        static_cast<ULONG>(plaintext.size()), &written, 0);
+        if (status != 0 || written != plaintext.size()) throw std::runtime_error("BCryptEncrypt AES-GCM failed");
+        return out;
+    }
+
+    std::vector<std::uint8_t> Aes256Gcm::open(const std::vector<std::uint8_t>& nonce,
+                                              const std::vector<std::uint8_t>& aad,
+                                              const std::vector<std::uint8_t>& sealed) const {
+        if (nonce.size() != nonce_size) throw std::invalid_argument("Aes256Gcm::open: nonce must be 12 bytes");
+        if (sealed.size() < tag_size) throw std::runtime_error("Aes256Gcm::open: input too short");
+
+        const std::size_t len = sealed.size() - tag_size;
+        std::vector<std::uint8_t> tag(sealed.end() - tag_size, sealed.end());
+        std::vector<std::uint8_t> out(len);
+        BCRYPT_AUTHENTICATED_CIPHER_MODE_INFO info;
+        BCRYPT_INIT_AUTH_MODE_INFO(info);
+        info.pbNonce = const_cast<PUCHAR>(nonce.data());
+        info.cbNonce = static_cast<ULONG>(nonce.size());
+        info.pbAuthData = aad.empty() ? nullptr : const_cast<PUCHAR>(aad.data());
+        info.cbAuthData = static_cast<ULONG>(aad.size());
+        info.pbTag = tag.data();
+        info.cbTag = static_cast<ULONG>(tag_size);
+
+        ULONG written = 0;
+        auto key = keys_.acquire([this] { return std::make_unique<KeyHandle>(static_cast<BCRYPT_KEY_HANDLE>(key_)); });
+        NTSTATUS status = BCryptDecrypt(key->key,
+                                        len == 0 ? nullptr : const_cast<PUCHAR>(sealed.data()),
+                                        static_cast<ULONG>(len), &info, nullptr, 0,
+                                        len == 0 ? nullptr : out.data(),
+                                        static_cast<ULONG>(len), &written, 0);
+        if (status == status_auth_tag_mismatch) throw std::runtime_error("Aes256Gcm::open: authentication failed");
+        if (status != 0 || written != len) throw std::runtime_error("BCryptDecrypt AES-GCM failed");
+        return out;
+    }
+
+} // namespace CryptoLib
@@ -0,0 +1,101 @@
+#include "arena.hpp"
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+namespace CryptoLib {
+
+    static std::size_t size_class(std::size_t bytes) {
+        std::size_t cls = 0;
+        while ((std::size_t(1) << cls) < bytes) ++cls;
+        return cls;
+    }
+
+    static void wipe(unsigned char* p, std::size_t bytes) noexcept {
+        // Blokovi su poravnati na 64 bajta i iseckani na višekratnike od 64
+        volatile std::uint64_t* w = reinterpret_cast<volatile std::uint64_t*>(p);
+        for (std::size_t i = 0; i < bytes / sizeof(std::uint64_t); ++i) w[i] = 0;
+    }
+
+    Arena& Arena::local() {
+        static thread_local Arena arena;
+        return arena;
+    }
+
+    Arena::~Arena() {
+        for (auto& b : blocks_) {
+            wipe(b.data, b.size);
+            ::operator delete(b.data, std::align_val_t(64));
+        }
+    }
+
+    void* Arena::allocate(std::size_t bytes) {
+        if (depth_ == 0) throw std::logic_error("Arena: allocation outside ArenaScope");
+        const std::size_t cls = std::max(size_class(bytes), min_class);
+        if (cls >= num_classes) throw std::bad_alloc();
+        const std::size_t chunk = std::size_t(1) << cls;
+
+        if (free_[cls] != nullptr) {
+            FreeNode* node = free_[cls];
+            free_[cls] = node->next;
+            in_use_ += chunk;
+            return node;
+        }
+
+        // Seci iz tekućeg bloka, pa iz sledećih postojećih, pa tek onda traži novi od sistema
+        while (block_index_ < blocks_.size() && offset_ + chunk > blocks_[block_index_].size) {
+            ++block_index_;
+            offset_ = 0;
+        }
+        if (block_index_ == blocks_.size()) {
+            const std::size_t size = std::max(block_size, chunk);
+            auto* data = static_cast<unsigned char*>(::operator new(size, std::align_val_t(64)));
+            blocks_.push_back(Block{ data, size });
+            ++system_allocations_;
+            offset_ = 0;
+        }
+
+        void* p = blocks_[block_index_].data + offset_;
+        offset_ += chunk;
+        in_use_ += chunk;
+        return p;
+    }
+
+    void Arena::deallocate(void* p, std::size_t bytes) noexcept {
+        if (p == nullptr) return;
+        const std::size_t cls = std::max(size_class(bytes), min_class);
+        auto* node = static_cast<FreeNode*>(p);
+        node->next = free_[cls];
+        free_[cls] = node;
+        in_use_ -= std::size_t(1) << cls;
+    }
+
+    void Arena::reset() noexcept {
+        for (std::size_t i = 0; i < blocks_.size() && i <= block_index_; ++i) {
+            wipe(blocks_[i].data, i == block_index_ ? offset_ : blocks_[i].size);
+        }
+        for (auto& f : free_) f = nullptr;
+        block_index_ = 0;
+        offset_ = 0;
+        in_use_ = 0;
+    }
+
+    Arena::Stats Arena::stats() const {
+        Stats s;
+        s.blocks = blocks_.size();
+        for (const auto& b : blocks_) s.reserved_bytes += b.size;
+        s.in_use_bytes = in_use_;
+        s.system_allocations = system_allocations_;
+        return s;
+    }
+
+    ArenaScope::ArenaScope() {
+        ++Arena::local().depth_;
+    }
+
+    ArenaScope::~ArenaScope() {
+        Arena& a = Arena::local();
+        if (--a.depth_ == 0) a.reset();
+    }
+
+} // namespace CryptoLib
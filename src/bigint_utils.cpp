@@ -1,13 +1,26 @@
 #include "bigint_utils.hpp"
+#include "mul_utils.hpp"
+#include "montgomery.hpp"
+#include <iterator>
 #include <stdexcept>
 
 namespace CryptoLib {
 
-    BigInt modexp(const BigInt& base, const BigInt& exp, const BigInt& mod) {
-        if (mod == 0) throw std::invalid_argument("modexp: mod must be > 0");
-        BigInt result = 1;
-        BigInt b = base % mod;
-        BigInt e = exp;
+    const char* bigint_backend_name() {
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        return "gmp";
+#elif defined(CRYPTOLIB_BIGINT_NATIVE)
+        return "native";
+#else
+        return "cpp_int";
+#endif
+    }
+
+    template <class Int>
+    static Int modexp_div(const Int& base, const Int& exp, const Int& mod) {
+        Int result = 1;
+        Int b = base % mod;
+        Int e = exp;
         while (e > 0) {
             if ((e & 1) != 0) {
                 result = (result * b) % mod;
@@ -18,17 +31,159 @@ namespace CryptoLib {
         return result;
     }
 
-    BigInt egcd(const BigInt& a, const BigInt& b, BigInt& x, BigInt& y) {
+    BigInt modexp(const BigInt& base, const BigInt& exp, const BigInt& mod) {
+        if (mod == 0) throw std::invalid_argument("modexp: mod must be > 0");
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        if (mod > 0 && exp >= 0) {
+            // mpz_powm_sec ne zavisi od vrednosti eksponenta po vremenu; traži neparan modul i exp > 0
+            BigInt r;
+            if (exp > 0 && (mod & 1) != 0)
+                mpz_powm_sec(r.backend().data(), base.backend().data(), exp.backend().data(), mod.backend().data());
+            else
+                mpz_powm(r.backend().data(), base.backend().data(), exp.backend().data(), mod.backend().data());
+            return r;
+        }
+#endif
+        if (mod > 1 && (mod & 1) != 0 && exp >= 0 && get_mont_kernel() != MontKernel::None) {
+            // Neparni moduli (RSA, Miller-Rabin): Montgomery, SIMD kernel kada CPU podržava
+            return mont_modexp(base, exp, mod);
+        }
+        if (limb_count(mod) >= get_mul_thresholds().barrett) {
+            // Veliki moduli: Karatsuba proizvodi + Barrett redukcija umesto deljenja
+            const BarrettReducer red(mod);
+            BigInt result = 1;
+            BigInt b = base % mod;
+            BigInt e = exp;
+            while (e > 0) {
+                if ((e & 1) != 0) {
+                    result = red.reduce(mul(result, b));
+                }
+                b = red.reduce(sqr(b));
+                e >>= 1;
+            }
+            return result;
+        }
+        ArenaScope scope;
+        return BigInt(modexp_div(ArenaBigInt(base), ArenaBigInt(exp), ArenaBigInt(mod)));
+    }
+
+    std::vector<BigInt> modexp_batch(const std::vector<BigInt>& bases, const std::vector<BigInt>& exps,
+                                     const std::vector<BigInt>& mods) {
+        const std::size_t count = bases.size();
+        if ((exps.size() != count && exps.size() != 1) || (mods.size() != count && mods.size() != 1))
+            throw std::invalid_argument("modexp_batch: size mismatch");
+        auto exp_at = [&](std::size_t i) -> const BigInt& { return exps.size() == 1 ? exps[0] : exps[i]; };
+        auto mod_at = [&](std::size_t i) -> const BigInt& { return mods.size() == 1 ? mods[0] : mods[i]; };
+
+        bool montgomery = get_mont_kernel() != MontKernel::None;
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        montgomery = false; // mpz_powm_sec je konstantnog vremena, Montgomery tabela nije
+#endif
+        for (std::size_t i = 0; montgomery && i < count; ++i) {
+            const BigInt& m = mod_at(i);
+            montgomery = m > 1 && (m & 1) != 0 && exp_at(i) >= 0;
+        }
+        if (montgomery) return mont_modexp_batch(bases, exps, mods);
+
+        std::vector<BigInt> out;
+        out.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) out.push_back(modexp(bases[i], exp_at(i), mod_at(i)));
+        return out;
+    }
+
+    ArenaBigInt modexp_arena(const ArenaBigInt& base, const ArenaBigInt& exp, const ArenaBigInt& mod) {
+        if (mod == 0) throw std::invalid_argument("modexp: mod must be > 0");
+        if (mod > 1 && (mod & 1) != 0 && exp >= 0 && get_mont_kernel() != MontKernel::None) {
+            return mont_modexp_arena(base, exp, mod);
+        }
+        return modexp_div(base, exp, mod);
+    }
+
+#if !defined(CRYPTOLIB_BIGINT_GMP)
+    // Lehmer (Knuth, TAOCP 4.5.2, algoritam L): vodeća 62 bita od A i B određuju niz
+    // Euklidovih koraka koji se računa u mašinskim rečima, a zatim se ceo niz primenjuje na
+    // velike brojeve sa četiri množenja rečju, umesto deljenja po koraku. Kada reči ne
+    // određuju ni jedan korak (velik količnik), radi se jedan pun korak deljenjem.
+    // Prati se samo koeficijent uz a; drugi se dobija na kraju iz a*x + b*y = g.
+    // a, b >= 0; sve privremene vrednosti su u areni.
+    static ArenaBigInt egcd_lehmer(const ArenaBigInt& a, const ArenaBigInt& b, ArenaBigInt& x, ArenaBigInt& y) {
         if (b == 0) {
             x = 1;
             y = 0;
             return a;
         }
-        BigInt x1, y1;
-        BigInt g = egcd(b, a % b, x1, y1);
-        x = y1;
-        y = x1 - (a / b) * y1;
+        // A = X0*a + (.)*b, B = X1*a + (.)*b
+        ArenaBigInt A = a, B = b, X0 = 1, X1 = 0, T, U, q;
+        if (A < B) {
+            A.swap(B);
+            X0.swap(X1);
+        }
+        while (B != 0) {
+            const unsigned top = msb(A);
+            const unsigned shift = top > 61 ? top - 61 : 0;
+            T = A >> shift;
+            std::int64_t ah = T.convert_to<std::int64_t>();
+            T = B >> shift;
+            std::int64_t bh = T.convert_to<std::int64_t>();
+
+            // Koraci nad rečima dok oba kraja intervala daju isti količnik
+            std::int64_t ua = 1, ub = 0, va = 0, vb = 1;
+            while (bh + va > 0 && bh + vb > 0) {
+                const std::int64_t qw = (ah + ua) / (bh + va);
+                if (qw != (ah + ub) / (bh + vb)) break;
+                std::int64_t t = ua - qw * va;
+                ua = va;
+                va = t;
+                t = ub - qw * vb;
+                ub = vb;
+                vb = t;
+                t = ah - qw * bh;
+                ah = bh;
+                bh = t;
+            }
+
+            if (ub == 0) {
+                boost::multiprecision::divide_qr(A, B, q, T);
+                A.swap(B);
+                B.swap(T);
+                T = X0 - q * X1;
+                X0.swap(X1);
+                X1.swap(T);
+            } else {
+                T = A * ua;
+                T += B * ub;
+                U = A * va;
+                U += B * vb;
+                A.swap(T);
+                B.swap(U);
+                T = X0 * ua;
+                T += X1 * ub;
+                U = X0 * va;
+                U += X1 * vb;
+                X0.swap(T);
+                X1.swap(U);
+            }
+        }
+        x = X0;
+        y = (A - a * X0) / b;
+        return A;
+    }
+#endif
+
+    BigInt egcd(const BigInt& a, const BigInt& b, BigInt& x, BigInt& y) {
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        BigInt g;
+        mpz_gcdext(g.backend().data(), x.backend().data(), y.backend().data(), a.backend().data(), b.backend().data());
         return g;
+#else
+        // Međurezultati su u areni; van nje izlaze samo x, y i g
+        ArenaScope scope;
+        ArenaBigInt xa, ya;
+        const ArenaBigInt g = egcd_lehmer(ArenaBigInt(abs(a)), ArenaBigInt(abs(b)), xa, ya);
+        x = BigInt(a < 0 ? ArenaBigInt(-xa) : xa);
+        y = BigInt(b < 0 ? ArenaBigInt(-ya) : ya);
+        return BigInt(g);
+#endif
     }
 
     BigInt modinv(const BigInt& a, const BigInt& m) {
@@ -42,28 +197,121 @@ namespace CryptoLib {
         return inv;
     }
 
+    // Montgomery-jev trik nad tipom Int (ArenaBigInt ili BigInt): a i prefix su radni nizovi
+    // dužine values.size(), invert(x, inv) daje x^-1 mod m u [0, m) ili false
+    template <class Int, class Vec, class Invert>
+    static void modinv_batch_impl(const std::vector<BigInt>& values, const Int& m, Vec& a, Vec& prefix,
+                                  Invert invert, std::vector<BigInt>& out) {
+        const std::size_t n = values.size();
+        // prefix[i] = a0 * ... * ai mod m
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = Int(values[i]) % m;
+            if (a[i] < 0) a[i] += m;
+            prefix[i] = i == 0 ? a[0] : Int(prefix[i - 1] * a[i] % m);
+        }
+
+        // Jedan inverz proizvoda; unazad: a_i^-1 = (a0..ai)^-1 * (a0..a_{i-1}), pa se
+        // inverz skida za a_i. Nula ili zajednički faktor sa m u bilo kom elementu čini
+        // proizvod neinvertibilnim.
+        Int inv;
+        if (!invert(prefix[n - 1], inv)) throw std::runtime_error("modinv_batch: inverse does not exist");
+        for (std::size_t i = n - 1; i > 0; --i) {
+            out[i] = BigInt(Int(inv * prefix[i - 1] % m));
+            inv = inv * a[i] % m;
+        }
+        out[0] = BigInt(inv);
+    }
+
+    std::vector<BigInt> modinv_batch(const std::vector<BigInt>& values, const BigInt& m) {
+        if (m <= 1) throw std::invalid_argument("modinv_batch: modulus must be > 1");
+        const std::size_t n = values.size();
+        std::vector<BigInt> out(n);
+        if (n == 0) return out;
+
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        // Proizvodi ostaju u mpz; inverz je mpz_invert. Radni nizovi se brišu (vrednosti su
+        // obično blinding faktori).
+        std::vector<BigInt> a(n), prefix(n);
+        auto wipe = [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                secure_wipe(a[i]);
+                secure_wipe(prefix[i]);
+            }
+        };
+        try {
+            modinv_batch_impl(values, m, a, prefix, [&](const BigInt& x, BigInt& inv) {
+                return mpz_invert(inv.backend().data(), x.backend().data(), m.backend().data()) != 0;
+            }, out);
+        } catch (...) {
+            wipe();
+            throw;
+        }
+        wipe();
+#else
+        // Međurezultati su u areni i brišu se sa njom
+        ArenaScope scope;
+        const ArenaBigInt ma(m);
+        std::vector<ArenaBigInt, ArenaAllocator<ArenaBigInt>> a(n), prefix(n);
+        modinv_batch_impl(values, ma, a, prefix, [&](const ArenaBigInt& x, ArenaBigInt& inv) {
+            ArenaBigInt y;
+            if (egcd_lehmer(x, ma, inv, y) != 1) return false;
+            inv %= ma;
+            if (inv < 0) inv += ma;
+            return true;
+        }, out);
+#endif
+        return out;
+    }
+
     std::vector<std::uint8_t> bigint_to_bytes(const BigInt& x) {
         if (x < 0) throw std::invalid_argument("bigint_to_bytes: negative not supported");
-        BigInt v = x;
+        if (x == 0) return { 0 }; // represent zero
+        // Big-endian direktno iz limbova, bez privremenih BigInt vrednosti po bajtu
         std::vector<std::uint8_t> out;
-        while (v > 0) {
-            std::uint8_t byte = static_cast<std::uint8_t>( (v & 0xFF).convert_to<unsigned long long>() );
-            out.push_back(byte);
-            v >>= 8;
-        }
-        // little-endian collected -> reverse to big-endian
-        std::reverse(out.begin(), out.end());
-        if (out.empty()) out.push_back(0); // represent zero
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        out.resize(mpz_sizeinbase(x.backend().data(), 256));
+        std::size_t written = 0;
+        mpz_export(out.data(), &written, 1, 1, 1, 0, x.backend().data());
+        out.resize(written);
+#else
+        out.reserve(msb(x) / 8 + 1);
+        boost::multiprecision::export_bits(x, std::back_inserter(out), 8, true);
+#endif
         return out;
     }
 
     BigInt bytes_to_bigint(const std::vector<std::uint8_t>& bytes) {
+        // Fiksni backend bi tiho odsekao višak bitova
+        if (bigint_max_bits != 0 && bytes.size() * 8 > bigint_max_bits)
+            throw std::invalid_argument("bytes_to_bigint: value exceeds BigInt capacity");
         BigInt x = 0;
-        for (std::uint8_t b : bytes) {
-            x <<= 8;
-            x += b;
-        }
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        if (!bytes.empty()) mpz_import(x.backend().data(), bytes.size(), 1, 1, 1, 0, bytes.data());
+#else
+        if (!bytes.empty()) boost::multiprecision::import_bits(x, bytes.begin(), bytes.end(), 8, true);
+#endif
         return x;
     }
 
+    void secure_wipe(BigInt& x) {
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        // Dodela prvo ponovo inicijalizuje moved-from vrednost (_mp_d == nullptr), a
+        // postojeći bafer ostaje isti, pa se i dalje briše ceo
+        x = 0;
+        __mpz_struct& z = x.backend().data()[0];
+        volatile mp_limb_t* p = z._mp_d;
+        for (int i = 0; i < z._mp_alloc; ++i) p[i] = 0;
+        return;
+#elif defined(CRYPTOLIB_BIGINT_NATIVE)
+        auto& backend = x.backend();
+        volatile boost::multiprecision::limb_type* p = backend.limbs();
+        for (unsigned i = 0; i < BigInt::backend_type::internal_limb_count; ++i) p[i] = 0;
+#else
+        auto& backend = x.backend();
+        volatile boost::multiprecision::limb_type* p = backend.limbs();
+        for (unsigned i = 0; i < backend.capacity(); ++i) p[i] = 0;
+#endif
+        x = 0;
+    }
+
 } // namespace CryptoLib
\ No newline at end of file
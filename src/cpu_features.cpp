@@ -0,0 +1,60 @@
+#include "cpu_features.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace CryptoLib {
+namespace detail {
+
+    static CpuFeatures query_cpu() {
+        CpuFeatures f;
+#if defined(CRYPTOLIB_SIMD)
+        unsigned regs[4] = { 0, 0, 0, 0 }; // eax, ebx, ecx, edx
+        auto cpuid = [&regs](unsigned leaf, unsigned sub) {
+#if defined(_MSC_VER)
+            int r[4];
+            __cpuidex(r, static_cast<int>(leaf), static_cast<int>(sub));
+            for (int i = 0; i < 4; ++i) regs[i] = static_cast<unsigned>(r[i]);
+#else
+            __cpuid_count(leaf, sub, regs[0], regs[1], regs[2], regs[3]);
+#endif
+        };
+
+        cpuid(0, 0);
+        if (regs[0] < 7) return f;
+        cpuid(1, 0);
+        const bool osxsave = (regs[2] & (1u << 27)) != 0;
+        if (!osxsave) return f;
+
+        // OS mora da čuva YMM (bitovi 1-2) odnosno ZMM/opmask (bitovi 5-7) stanje
+#if defined(_MSC_VER)
+        const unsigned long long xcr0 = _xgetbv(0);
+#else
+        unsigned lo = 0, hi = 0;
+        __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+        const unsigned long long xcr0 = (static_cast<unsigned long long>(hi) << 32) | lo;
+#endif
+        const bool os_ymm = (xcr0 & 0x06) == 0x06;
+        const bool os_zmm = (xcr0 & 0xE6) == 0xE6;
+
+        cpuid(7, 0);
+        const bool avx2 = (regs[1] & (1u << 5)) != 0;
+        const bool avx512f = (regs[1] & (1u << 16)) != 0;
+        const bool ifma = (regs[1] & (1u << 21)) != 0;
+
+        f.avx2 = avx2 && os_ymm;
+        f.avx512_ifma = avx512f && ifma && os_zmm;
+#endif
+        return f;
+    }
+
+    const CpuFeatures& cpu_features() {
+        static const CpuFeatures f = query_cpu();
+        return f;
+    }
+
+} // namespace detail
+} // namespace CryptoLib
@@ -0,0 +1,18 @@
+#pragma once
+
+// Interna detekcija SIMD mogućnosti CPU-a (CPUID + XGETBV), zajednička za Montgomery
+// kernele i hex/base64 kodeke. Bez CRYPTOLIB_SIMD sve je false.
+
+namespace CryptoLib {
+namespace detail {
+
+    struct CpuFeatures {
+        bool avx2 = false;
+        bool avx512_ifma = false;
+    };
+
+    // Računa se jednom, pri prvom pozivu
+    const CpuFeatures& cpu_features();
+
+} // namespace detail
+} // namespace CryptoLib
@@ -0,0 +1,213 @@
+#include "encoding.hpp"
+#include "encoding_kernels.hpp"
+#include "cpu_features.hpp"
+#include <atomic>
+#include <stdexcept>
+
+namespace CryptoLib {
+
+    bool codec_kernel_supported(CodecKernel kernel) {
+        switch (kernel) {
+        case CodecKernel::Scalar: return true;
+        case CodecKernel::AVX2: return detail::cpu_features().avx2;
+        }
+        return false;
+    }
+
+    const char* codec_kernel_name(CodecKernel kernel) {
+        switch (kernel) {
+        case CodecKernel::Scalar: return "scalar";
+        case CodecKernel::AVX2: return "avx2";
+        }
+        return "unknown";
+    }
+
+    static std::atomic<CodecKernel>& active_kernel() {
+        static std::atomic<CodecKernel> k{ codec_kernel_supported(CodecKernel::AVX2) ? CodecKernel::AVX2
+                                                                                      : CodecKernel::Scalar };
+        return k;
+    }
+
+    CodecKernel get_codec_kernel() {
+        return active_kernel().load(std::memory_order_relaxed);
+    }
+
+    void set_codec_kernel(CodecKernel kernel) {
+        if (!codec_kernel_supported(kernel))
+            throw std::invalid_argument("set_codec_kernel: kernel not supported on this CPU");
+        active_kernel().store(kernel, std::memory_order_relaxed);
+    }
+
+    static bool use_avx2() {
+#if defined(CRYPTOLIB_SIMD)
+        return get_codec_kernel() == CodecKernel::AVX2;
+#else
+        return false;
+#endif
+    }
+
+    // ---- Tabele ----
+
+    static const char hex_digits[] = "0123456789abcdef";
+    static const char b64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    static constexpr std::uint8_t invalid = 0xFF;
+
+    struct DecodeTables {
+        std::uint8_t hex[256];
+        std::uint8_t b64[256];
+
+        DecodeTables() {
+            for (int i = 0; i < 256; ++i) hex[i] = b64[i] = invalid;
+            for (int i = 0; i < 10; ++i) hex['0' + i] = static_cast<std::uint8_t>(i);
+            for (int i = 0; i < 6; ++i) {
+                hex['a' + i] = static_cast<std::uint8_t>(10 + i);
+                hex['A' + i] = static_cast<std::uint8_t>(10 + i);
+            }
+            for (int i = 0; i < 64; ++i) b64[static_cast<unsigned char>(b64_alphabet[i])] = static_cast<std::uint8_t>(i);
+        }
+    };
+
+    static const DecodeTables& tables() {
+        static const DecodeTables t;
+        return t;
+    }
+
+    // ---- Hex ----
+
+    std::size_t hex_decoded_size(std::size_t len) {
+        if (len % 2 != 0) throw std::invalid_argument("hex_decode: odd number of hex characters");
+        return len / 2;
+    }
+
+    void hex_encode(const std::uint8_t* in, std::size_t n, char* out) {
+        std::size_t i = 0;
+#if defined(CRYPTOLIB_SIMD)
+        if (use_avx2()) i = detail::hex_encode_avx2(in, n, out);
+#endif
+        for (; i < n; ++i) {
+            out[2 * i] = hex_digits[in[i] >> 4];
+            out[2 * i + 1] = hex_digits[in[i] & 0x0F];
+        }
+    }
+
+    std::size_t hex_decode(const char* in, std::size_t len, std::uint8_t* out) {
+        const std::size_t n = hex_decoded_size(len);
+        std::size_t i = 0;
+#if defined(CRYPTOLIB_SIMD)
+        if (use_avx2()) i = detail::hex_decode_avx2(in, len, out);
+#endif
+        const std::uint8_t* t = tables().hex;
+        for (; i < len; i += 2) {
+            const std::uint8_t hi = t[static_cast<unsigned char>(in[i])];
+            const std::uint8_t lo = t[static_cast<unsigned char>(in[i + 1])];
+            if (hi == invalid || lo == invalid)
+                throw std::invalid_argument("hex_decode: invalid hex character at offset " +
+                                            std::to_string(hi == invalid ? i : i + 1));
+            out[i / 2] = static_cast<std::uint8_t>((hi << 4) | lo);
+        }
+        return n;
+    }
+
+    std::string hex_encode(const std::vector<std::uint8_t>& data) {
+        std::string out(hex_encoded_size(data.size()), '\0');
+        hex_encode(data.data(), data.size(), &out[0]);
+        return out;
+    }
+
+    std::vector<std::uint8_t> hex_decode(const std::string& hex) {
+        std::vector<std::uint8_t> out(hex_decoded_size(hex.size()));
+        hex_decode(hex.data(), hex.size(), out.data());
+        return out;
+    }
+
+    // ---- Base64 ----
+
+    std::size_t base64_decoded_size(const char* in, std::size_t len) {
+        if (len % 4 != 0) throw std::invalid_argument("base64_decode: length is not a multiple of 4");
+        if (len == 0) return 0;
+        std::size_t pad = 0;
+        if (in[len - 1] == '=') ++pad;
+        if (in[len - 2] == '=') ++pad;
+        return len / 4 * 3 - pad;
+    }
+
+    void base64_encode(const std::uint8_t* in, std::size_t n, char* out) {
+        std::size_t i = 0;
+        std::size_t o = 0;
+#if defined(CRYPTOLIB_SIMD)
+        if (use_avx2()) {
+            i = detail::base64_encode_avx2(in, n, out);
+            o = i / 3 * 4;
+        }
+#endif
+        for (; i + 3 <= n; i += 3, o += 4) {
+            const std::uint32_t v = (std::uint32_t(in[i]) << 16) | (std::uint32_t(in[i + 1]) << 8) | in[i + 2];
+            out[o] = b64_alphabet[v >> 18];
+            out[o + 1] = b64_alphabet[(v >> 12) & 0x3F];
+            out[o + 2] = b64_alphabet[(v >> 6) & 0x3F];
+            out[o + 3] = b64_alphabet[v & 0x3F];
+        }
+        if (i < n) {
+            const std::uint32_t v = (std::uint32_t(in[i]) << 16) | (i + 1 < n ? std::uint32_t(in[i + 1]) << 8 : 0);
+            out[o] = b64_alphabet[v >> 18];
+            out[o + 1] = b64_alphabet[(v >> 12) & 0x3F];
+            out[o + 2] = i + 1 < n ? b64_alphabet[(v >> 6) & 0x3F] : '=';
+            out[o + 3] = '=';
+        }
+    }
+
+    std::size_t base64_decode(const char* in, std::size_t len, std::uint8_t* out) {
+        const std::size_t n = base64_decoded_size(in, len);
+        std::size_t i = 0;
+        std::size_t o = 0;
+#if defined(CRYPTOLIB_SIMD)
+        if (use_avx2()) {
+            i = detail::base64_decode_avx2(in, len, out);
+            o = i / 4 * 3;
+        }
+#endif
+        const std::uint8_t* t = tables().b64;
+        auto fail = [](std::size_t pos) {
+            throw std::invalid_argument("base64_decode: invalid character at offset " + std::to_string(pos));
+        };
+        for (; i < len; i += 4) {
+            const bool last = i + 4 == len;
+            std::uint8_t d[4];
+            std::size_t chars = 4;
+            for (std::size_t j = 0; j < 4; ++j) {
+                const char c = in[i + j];
+                if (c == '=' && last && j >= 2) {
+                    // '=' je dozvoljen samo kao završni padding: "xx==" ili "xxx="
+                    if (j == 2 && in[i + 3] != '=') fail(i + j);
+                    chars = j;
+                    break;
+                }
+                d[j] = t[static_cast<unsigned char>(c)];
+                if (d[j] == invalid) fail(i + j);
+            }
+
+            const std::uint32_t v = (std::uint32_t(d[0]) << 18) | (std::uint32_t(d[1]) << 12) |
+                                    (chars > 2 ? std::uint32_t(d[2]) << 6 : 0) | (chars > 3 ? d[3] : 0);
+            out[o++] = static_cast<std::uint8_t>(v >> 16);
+            if (chars > 2) out[o++] = static_cast<std::uint8_t>(v >> 8);
+            if (chars > 3) out[o++] = static_cast<std::uint8_t>(v);
+            // Kanonski zapis: bitovi ispod poslednjeg bajta moraju biti 0
+            if ((chars == 2 && (v & 0xFFFF) != 0) || (chars == 3 && (v & 0xFF) != 0))
+                throw std::invalid_argument("base64_decode: non-zero padding bits");
+        }
+        return n;
+    }
+
+    std::string base64_encode(const std::vector<std::uint8_t>& data) {
+        std::string out(base64_encoded_size(data.size()), '\0');
+        base64_encode(data.data(), data.size(), &out[0]);
+        return out;
+    }
+
+    std::vector<std::uint8_t> base64_decode(const std::string& text) {
+        std::vector<std::uint8_t> out(base64_decoded_size(text.data(), text.size()));
+        base64_decode(text.data(), text.size(), out.data());
+        return out;
+    }
+
+} // namespace CryptoLib
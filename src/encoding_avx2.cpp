@@ -0,0 +1,133 @@
+#include "encoding_kernels.hpp"
+#include <immintrin.h>
+
+namespace CryptoLib {
+namespace detail {
+
+    // ---- Hex ----
+
+    std::size_t hex_encode_avx2(const std::uint8_t* in, std::size_t n, char* out) {
+        const __m256i lut = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                             '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+                                             '0', '1', '2', '3', '4', '5', '6', '7',
+                                             '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+        const __m256i low4 = _mm256_set1_epi8(0x0F);
+        std::size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            const __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), low4));
+            const __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, low4));
+            // unpack radi po 128-bitnim lanovima: a = [0..7 | 16..23], b = [8..15 | 24..31]
+            const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+            const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i), _mm256_permute2x128_si256(a, b, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + 32), _mm256_permute2x128_si256(a, b, 0x31));
+        }
+        return i;
+    }
+
+    // 32 hex znaka -> 16 vrednosti u 16-bitnim rečima; false ako ima neispravnih znakova
+    static inline bool hex_pairs(const char* in, __m256i& pairs) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+        const __m256i l = _mm256_or_si256(v, _mm256_set1_epi8(0x20)); // 'A'-'F' -> 'a'-'f'
+        // Poređenja su označena: znakovi >= 0x80 ne prolaze ni jednu proveru
+        const __m256i is_digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)),
+                                                  _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+        const __m256i is_alpha = _mm256_and_si256(_mm256_cmpgt_epi8(l, _mm256_set1_epi8('a' - 1)),
+                                                  _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), l));
+        if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha)) != -1) return false;
+
+        const __m256i val = _mm256_blendv_epi8(_mm256_sub_epi8(l, _mm256_set1_epi8('a' - 10)),
+                                               _mm256_sub_epi8(v, _mm256_set1_epi8('0')), is_digit);
+        // (visok, nizak) -> visok * 16 + nizak
+        pairs = _mm256_maddubs_epi16(val, _mm256_set1_epi16(0x0110));
+        return true;
+    }
+
+    std::size_t hex_decode_avx2(const char* in, std::size_t len, std::uint8_t* out) {
+        std::size_t i = 0;
+        for (; i + 64 <= len; i += 64) {
+            __m256i p0, p1;
+            if (!hex_pairs(in + i, p0) || !hex_pairs(in + i + 32, p1)) break;
+            // packus radi po lanovima: [p0 lo, p1 lo, p0 hi, p1 hi] -> vrati redosled
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(p0, p1), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i / 2), packed);
+        }
+        return i;
+    }
+
+    // ---- Base64 (Muła, Lemire: "Faster Base64 Encoding and Decoding using AVX2 Instructions") ----
+
+    std::size_t base64_encode_avx2(const std::uint8_t* in, std::size_t n, char* out) {
+        // Po lanu: 12 bajtova -> četiri 32-bitne reči [b1, b0, b2, b1] po grupi od 3 bajta
+        const __m128i shuf = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        const __m256i shuf2 = _mm256_broadcastsi128_si256(shuf);
+        const __m256i lut = _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
+                                             65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+        std::size_t i = 0;
+        std::size_t o = 0;
+        for (; i + 28 <= n; i += 24, o += 32) {
+            const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12));
+            __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+            v = _mm256_shuffle_epi8(v, shuf2);
+
+            // Izdvajanje četiri 6-bitne vrednosti po 32-bitnoj reči
+            const __m256i t0 = _mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00));
+            const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+            const __m256i t2 = _mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0));
+            const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+            const __m256i idx = _mm256_or_si256(t1, t3);
+
+            // 0..25 -> 'A', 26..51 -> 'a', 52..61 -> '0', 62 -> '+', 63 -> '/'
+            __m256i sel = _mm256_subs_epu8(idx, _mm256_set1_epi8(51));
+            sel = _mm256_sub_epi8(sel, _mm256_cmpgt_epi8(idx, _mm256_set1_epi8(25)));
+            const __m256i chars = _mm256_add_epi8(idx, _mm256_shuffle_epi8(lut, sel));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + o), chars);
+        }
+        return i;
+    }
+
+    std::size_t base64_decode_avx2(const char* in, std::size_t len, std::uint8_t* out) {
+        const __m256i lut_lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                                0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m256i lut_hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                                0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                                0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                                0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m256i lut_roll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                  0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m256i mask_2f = _mm256_set1_epi8(0x2F);
+        const __m256i pack_shuf = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                   2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+        const __m256i pack_perm = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+        std::size_t i = 0;
+        std::size_t o = 0;
+        for (; i + 32 < len; i += 32, o += 24) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            const __m256i hi_nib = _mm256_and_si256(_mm256_srli_epi32(v, 4), mask_2f);
+            const __m256i lo_nib = _mm256_and_si256(v, mask_2f);
+            const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nib);
+            const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nib);
+            if (!_mm256_testz_si256(lo, hi)) break; // neispravan znak ('=' je ovde takođe greška)
+
+            const __m256i eq_2f = _mm256_cmpeq_epi8(v, mask_2f);
+            const __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2f, hi_nib));
+            v = _mm256_add_epi8(v, roll); // 6-bitne vrednosti
+
+            // 4 x 6 bita -> 3 bajta po 32-bitnoj reči
+            const __m256i ab_bc = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+            __m256i packed = _mm256_madd_epi16(ab_bc, _mm256_set1_epi32(0x00011000));
+            packed = _mm256_shuffle_epi8(packed, pack_shuf);
+            packed = _mm256_permutevar8x32_epi32(packed, pack_perm);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + o), _mm256_castsi256_si128(packed));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + o + 16), _mm256_extracti128_si256(packed, 1));
+        }
+        return i;
+    }
+
+} // namespace detail
+} // namespace CryptoLib
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Interni AVX2 kerneli za hex/base64 (encoding_avx2.cpp). Svaki obrađuje najduži prefiks
+// koji može u celim blokovima i vraća broj obrađenih ulaznih bajtova/znakova; ostatak
+// (i tačnu poziciju greške) rešava skalarni kod u encoding.cpp.
+
+namespace CryptoLib {
+namespace detail {
+
+    // 32 bajta -> 64 znaka po iteraciji
+    std::size_t hex_encode_avx2(const std::uint8_t* in, std::size_t n, char* out);
+    // 64 znaka -> 32 bajta; staje pre prvog bloka sa neispravnim znakom
+    std::size_t hex_decode_avx2(const char* in, std::size_t len, std::uint8_t* out);
+
+    // 24 bajta -> 32 znaka; ostavlja najmanje 4 bajta ulaza (čita 16 bajtova od in + 12)
+    std::size_t base64_encode_avx2(const std::uint8_t* in, std::size_t n, char* out);
+    // 32 znaka -> 24 bajta; ostavlja poslednju grupu od 4 znaka (padding) skalarnom kodu
+    // i staje pre prvog bloka sa neispravnim znakom
+    std::size_t base64_decode_avx2(const char* in, std::size_t len, std::uint8_t* out);
+
+} // namespace detail
+} // namespace CryptoLib
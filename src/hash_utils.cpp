@@ -1,4 +1,5 @@
 #include "hash_utils.hpp"
+#include "utils.hpp"
 #include <stdexcept>
 #include <windows.h>
 #include <bcrypt.h>
@@ -6,34 +7,156 @@
 #pragma comment(lib, "bcrypt.lib")
 
 namespace CryptoLib {
+
+    // Provider se otvara jednom po algoritmu (otvaranje je skupo, a MGF1 hešira više puta
+    // po poruci); BCrypt dozvoljava deljenje istog handle-a između niti.
+    struct HashProvider {
+        BCRYPT_ALG_HANDLE alg = nullptr;
+        DWORD object_size = 0;
+        DWORD hash_len = 0;
+
+        HashProvider(LPCWSTR name, DWORD expected_len) {
+            NTSTATUS status = BCryptOpenAlgorithmProvider(&alg, name, nullptr, 0);
+            if (status != 0) throw std::runtime_error("BCryptOpenAlgorithmProvider SHA failed");
+
+            DWORD dataLen = 0;
+            status = BCryptGetProperty(alg, BCRYPT_OBJECT_LENGTH, (PUCHAR)&object_size, sizeof(object_size), &dataLen, 0);
+            if (status != 0) { BCryptCloseAlgorithmProvider(alg,0); throw std::runtime_error("BCryptGetProperty OBJECT_LENGTH failed"); }
+
+            status = BCryptGetProperty(alg, BCRYPT_HASH_LENGTH, (PUCHAR)&hash_len, sizeof(hash_len), &dataLen, 0);
+            if (status != 0 || hash_len != expected_len) { BCryptCloseAlgorithmProvider(alg,0); throw std::runtime_error("BCryptGetProperty HASH_LENGTH failed"); }
+        }
+
+        ~HashProvider() {
+            BCryptCloseAlgorithmProvider(alg, 0);
+        }
+
+        // Novi hash objekat u object (veličine object_size)
+        BCRYPT_HASH_HANDLE create(std::vector<std::uint8_t>& object) const {
+            object.resize(object_size);
+            BCRYPT_HASH_HANDLE hHash = nullptr;
+            NTSTATUS status = BCryptCreateHash(alg, &hHash, object.data(), static_cast<ULONG>(object.size()), nullptr, 0, 0);
+            if (status != 0) throw std::runtime_error("BCryptCreateHash failed");
+            return hHash;
+        }
+
+        std::vector<std::uint8_t> hash(const std::vector<std::uint8_t>& data) const {
+            std::vector<std::uint8_t> hashObject;
+            BCRYPT_HASH_HANDLE hHash = create(hashObject);
+
+            NTSTATUS status = BCryptHashData(hHash, const_cast<PUCHAR>(data.data()), static_cast<ULONG>(data.size()), 0);
+            if (status != 0) { BCryptDestroyHash(hHash); throw std::runtime_error("BCryptHashData failed"); }
+
+            std::vector<std::uint8_t> out(hash_len);
+            status = BCryptFinishHash(hHash, out.data(), hash_len, 0);
+            BCryptDestroyHash(hHash);
+
+            if (status != 0) throw std::runtime_error("BCryptFinishHash failed");
+            return out;
+        }
+    };
+
+    template <class Hash>
+    static const HashProvider& provider();
+
+    template <>
+    const HashProvider& provider<Sha256>() {
+        static const HashProvider p(BCRYPT_SHA256_ALGORITHM, 32);
+        return p;
+    }
+
+    template <>
+    const HashProvider& provider<Sha384>() {
+        static const HashProvider p(BCRYPT_SHA384_ALGORITHM, 48);
+        return p;
+    }
+
+    template <>
+    const HashProvider& provider<Sha512>() {
+        static const HashProvider p(BCRYPT_SHA512_ALGORITHM, 64);
+        return p;
+    }
+
     std::vector<std::uint8_t> sha256(const std::vector<std::uint8_t>& data) {
-        BCRYPT_ALG_HANDLE hAlg = nullptr;
-        NTSTATUS status = BCryptOpenAlgorithmProvider(&hAlg, BCRYPT_SHA256_ALGORITHM, nullptr, 0);
-        if (status != 0) throw std::runtime_error("BCryptOpenAlgorithmProvider SHA-256 failed");
+        return provider<Sha256>().hash(data);
+    }
 
-        DWORD hashObjectSize = 0, dataLen = 0;
-        status = BCryptGetProperty(hAlg, BCRYPT_OBJECT_LENGTH, (PUCHAR)&hashObjectSize, sizeof(hashObjectSize), &dataLen, 0);
-        if (status != 0) { BCryptCloseAlgorithmProvider(hAlg,0); throw std::runtime_error("BCryptGetProperty OBJECT_LENGTH failed"); }
+    std::vector<std::uint8_t> sha384(const std::vector<std::uint8_t>& data) {
+        return provider<Sha384>().hash(data);
+    }
 
-        std::vector<std::uint8_t> hashObject(hashObjectSize);
+    std::vector<std::uint8_t> sha512(const std::vector<std::uint8_t>& data) {
+        return provider<Sha512>().hash(data);
+    }
 
-        DWORD hashLen = 0;
-        status = BCryptGetProperty(hAlg, BCRYPT_HASH_LENGTH, (PUCHAR)&hashLen, sizeof(hashLen), &dataLen, 0);
-        if (status != 0 || hashLen != 32) { BCryptCloseAlgorithmProvider(hAlg,0); throw std::runtime_error("BCryptGetProperty HASH_LENGTH failed"); }
+    // ---- HashContext ----
 
-        BCRYPT_HASH_HANDLE hHash = nullptr;
-        status = BCryptCreateHash(hAlg, &hHash, hashObject.data(), static_cast<ULONG>(hashObject.size()), nullptr, 0, 0);
-        if (status != 0) { BCryptCloseAlgorithmProvider(hAlg,0); throw std::runtime_error("BCryptCreateHash failed"); }
+    template <class Hash>
+    HashContext<Hash>::HashContext() {
+        hash_ = provider<Hash>().create(object_);
+    }
 
-        status = BCryptHashData(hHash, const_cast<PUCHAR>(data.data()), static_cast<ULONG>(data.size()), 0);
-        if (status != 0) { BCryptDestroyHash(hHash); BCryptCloseAlgorithmProvider(hAlg,0); throw std::runtime_error("BCryptHashData failed"); }
+    // Stanje hash-a može zavisiti od tajne (HMAC ključ), pa se memorija objekta briše
+    template <class Hash>
+    HashContext<Hash>::~HashContext() {
+        if (hash_) BCryptDestroyHash(static_cast<BCRYPT_HASH_HANDLE>(hash_));
+        secure_wipe(object_);
+    }
 
-        std::vector<std::uint8_t> hash(hashLen);
-        status = BCryptFinishHash(hHash, hash.data(), hashLen, 0);
-        BCryptDestroyHash(hHash);
-        BCryptCloseAlgorithmProvider(hAlg, 0);
+    template <class Hash>
+    void* HashContext<Hash>::handle() {
+        if (!hash_) hash_ = provider<Hash>().create(object_);
+        return hash_;
+    }
 
+    template <class Hash>
+    void HashContext<Hash>::update(const std::uint8_t* data, std::size_t len) {
+        BCRYPT_HASH_HANDLE h = static_cast<BCRYPT_HASH_HANDLE>(handle());
+        // BCryptHashData prima ULONG dužinu; veći ulaz ide u delovima
+        while (len > 0) {
+            const ULONG chunk = static_cast<ULONG>(len < 0x40000000u ? len : 0x40000000u);
+            NTSTATUS status = BCryptHashData(h, const_cast<PUCHAR>(data), chunk, 0);
+            if (status != 0) throw std::runtime_error("BCryptHashData failed");
+            data += chunk;
+            len -= chunk;
+        }
+    }
+
+    template <class Hash>
+    void HashContext<Hash>::finish(std::uint8_t* out) {
+        NTSTATUS status = BCryptFinishHash(static_cast<BCRYPT_HASH_HANDLE>(handle()), out,
+                                           static_cast<ULONG>(Hash::digest_size), 0);
+        // Završen BCrypt hash se ne može nastaviti; novi objekat se pravi tek kada zatreba,
+        // pa assign() posle finish() ne plaća pravljenje praznog
+        BCryptDestroyHash(static_cast<BCRYPT_HASH_HANDLE>(hash_));
+        hash_ = nullptr;
         if (status != 0) throw std::runtime_error("BCryptFinishHash failed");
-        return hash;
     }
-}
\ No newline at end of file
+
+    template <class Hash>
+    std::vector<std::uint8_t> HashContext<Hash>::finish() {
+        std::vector<std::uint8_t> out(Hash::digest_size);
+        finish(out.data());
+        return out;
+    }
+
+    template <class Hash>
+    void HashContext<Hash>::assign(const HashContext& other) {
+        if (this == &other) return;
+        if (hash_) {
+            BCryptDestroyHash(static_cast<BCRYPT_HASH_HANDLE>(hash_));
+            hash_ = nullptr;
+        }
+        if (!other.hash_) return; // drugi je posle finish(), tj. prazan
+        object_.resize(other.object_.size());
+        BCRYPT_HASH_HANDLE h = nullptr;
+        NTSTATUS status = BCryptDuplicateHash(static_cast<BCRYPT_HASH_HANDLE>(other.hash_), &h, object_.data(),
+                                              static_cast<ULONG>(object_.size()), 0);
+        if (status != 0) throw std::runtime_error("BCryptDuplicateHash failed");
+        hash_ = h;
+    }
+
+    template class HashContext<Sha256>;
+    template class HashContext<Sha384>;
+    template class HashContext<Sha512>;
+}
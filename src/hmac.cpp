@@ -0,0 +1,167 @@
+#include "hmac.hpp"
+#include "utils.hpp"
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+namespace CryptoLib {
+
+    // Radni kontekst po niti i hash-u: MAC ne pravi nov hash objekat po poruci. Svaka
+    // upotreba počinje sa assign(), pa ostatak prekinutog poziva ne utiče na rezultat.
+    template <class Hash>
+    static HashContext<Hash>& work_context() {
+        static thread_local HashContext<Hash> ctx;
+        return ctx;
+    }
+
+    template <class Hash>
+    Hmac<Hash>::Hmac(const std::vector<std::uint8_t>& key) : Hmac(key.data(), key.size()) {}
+
+    template <class Hash>
+    Hmac<Hash>::Hmac(const std::uint8_t* key, std::size_t len) {
+        std::vector<std::uint8_t> block(Hash::block_size, 0);
+        if (len > Hash::block_size) {
+            HashContext<Hash> ctx;
+            ctx.update(key, len);
+            ctx.finish(block.data());
+        } else {
+            std::copy(key, key + len, block.begin());
+        }
+
+        for (auto& b : block) b ^= 0x36;
+        keyed_.inner.update(block);
+        for (auto& b : block) b ^= 0x36 ^ 0x5c;
+        keyed_.outer.update(block);
+        secure_wipe(block);
+    }
+
+    template <class Hash>
+    typename HandlePool<typename Hmac<Hash>::Midstates>::Lease Hmac<Hash>::lease() const {
+        return copies_.acquire([this] {
+            auto copy = std::make_unique<Midstates>();
+            copy->inner.assign(keyed_.inner);
+            copy->outer.assign(keyed_.outer);
+            return copy;
+        });
+    }
+
+    template <class Hash>
+    void Hmac<Hash>::mac(const Midstates& mid, const std::uint8_t* data, std::size_t len, std::uint8_t* out) {
+        HashContext<Hash>& ctx = work_context<Hash>();
+        std::uint8_t inner[Hash::digest_size];
+        ctx.assign(mid.inner);
+        ctx.update(data, len);
+        ctx.finish(inner);
+        ctx.assign(mid.outer);
+        ctx.update(inner, sizeof(inner));
+        ctx.finish(out);
+    }
+
+    template <class Hash>
+    void Hmac<Hash>::mac(const std::uint8_t* data, std::size_t len, std::uint8_t* out) const {
+        mac(*lease(), data, len, out);
+    }
+
+    template <class Hash>
+    std::vector<std::uint8_t> Hmac<Hash>::mac(const std::uint8_t* data, std::size_t len) const {
+        std::vector<std::uint8_t> out(tag_size);
+        mac(data, len, out.data());
+        return out;
+    }
+
+    template <class Hash>
+    bool Hmac<Hash>::verify(const std::vector<std::uint8_t>& data, const std::vector<std::uint8_t>& tag) const {
+        if (tag.size() != tag_size) return false;
+        std::uint8_t expected[tag_size];
+        mac(data.data(), data.size(), expected);
+        std::uint8_t diff = 0;
+        for (std::size_t i = 0; i < tag_size; ++i) diff |= static_cast<std::uint8_t>(expected[i] ^ tag[i]);
+        return diff == 0;
+    }
+
+    template <class Hash>
+    void Hmac<Hash>::mac_batch(const std::vector<std::vector<std::uint8_t>>& messages, std::uint8_t* out) const {
+        const auto mid = lease();
+        for (const auto& m : messages) {
+            mac(*mid, m.data(), m.size(), out);
+            out += tag_size;
+        }
+    }
+
+    template <class Hash>
+    std::vector<std::vector<std::uint8_t>> Hmac<Hash>::mac_batch(const std::vector<std::vector<std::uint8_t>>& messages) const {
+        std::vector<std::vector<std::uint8_t>> tags;
+        tags.reserve(messages.size());
+        const auto mid = lease();
+        for (const auto& m : messages) {
+            tags.emplace_back(tag_size);
+            mac(*mid, m.data(), m.size(), tags.back().data());
+        }
+        return tags;
+    }
+
+    std::vector<std::uint8_t> hmac_sha256(const std::vector<std::uint8_t>& key, const std::vector<std::uint8_t>& data) {
+        return HmacSha256(key).mac(data);
+    }
+
+    // ---- HKDF ----
+
+    template <class Hash>
+    std::vector<std::uint8_t> hkdf_extract(const std::vector<std::uint8_t>& salt, const std::vector<std::uint8_t>& ikm) {
+        // HMAC dopunjuje ključ nulama do bloka, pa je prazan salt isto što i digest_size nula
+        return Hmac<Hash>(salt).mac(ikm);
+    }
+
+    template <class Hash>
+    std::vector<std::uint8_t> hkdf_expand(const std::vector<std::uint8_t>& prk, const std::vector<std::uint8_t>& info,
+                                          std::size_t length) {
+        if (length > 255 * Hash::digest_size) throw std::invalid_argument("hkdf_expand: length too large");
+        const Hmac<Hash> hmac(prk);
+
+        // T(i) = HMAC(PRK, T(i-1) || info || i), T(0) prazan
+        std::vector<std::uint8_t> okm(length);
+        std::vector<std::uint8_t> input;
+        input.reserve(Hash::digest_size + info.size() + 1);
+        std::uint8_t t[Hash::digest_size];
+        for (std::size_t off = 0, i = 1; off < length; off += Hash::digest_size, ++i) {
+            input.clear();
+            if (i > 1) input.insert(input.end(), t, t + Hash::digest_size);
+            input.insert(input.end(), info.begin(), info.end());
+            input.push_back(static_cast<std::uint8_t>(i));
+            hmac.mac(input.data(), input.size(), t);
+            std::copy(t, t + std::min(Hash::digest_size, length - off), okm.begin() + off);
+        }
+        secure_wipe(input);
+        secure_wipe(t, sizeof(t));
+        return okm;
+    }
+
+    template <class Hash>
+    std::vector<std::uint8_t> hkdf(const std::vector<std::uint8_t>& salt, const std::vector<std::uint8_t>& ikm,
+                                   const std::vector<std::uint8_t>& info, std::size_t length) {
+        std::vector<std::uint8_t> prk = hkdf_extract<Hash>(salt, ikm);
+        std::vector<std::uint8_t> okm = hkdf_expand<Hash>(prk, info, length);
+        secure_wipe(prk);
+        return okm;
+    }
+
+    std::vector<std::uint8_t> hkdf_sha256(const std::vector<std::uint8_t>& salt, const std::vector<std::uint8_t>& ikm,
+                                          const std::vector<std::uint8_t>& info, std::size_t length) {
+        return hkdf<Sha256>(salt, ikm, info, length);
+    }
+
+#define CRYPTOLIB_HMAC_INSTANTIATE(H)                                                                          \
+    template class Hmac<H>;                                                                                    \
+    template std::vector<std::uint8_t> hkdf_extract<H>(const std::vector<std::uint8_t>&,                       \
+                                                       const std::vector<std::uint8_t>&);                      \
+    template std::vector<std::uint8_t> hkdf_expand<H>(const std::vector<std::uint8_t>&,                        \
+                                                      const std::vector<std::uint8_t>&, std::size_t);          \
+    template std::vector<std::uint8_t> hkdf<H>(const std::vector<std::uint8_t>&, const std::vector<std::uint8_t>&, \
+                                               const std::vector<std::uint8_t>&, std::size_t);
+
+    CRYPTOLIB_HMAC_INSTANTIATE(Sha256)
+    CRYPTOLIB_HMAC_INSTANTIATE(Sha384)
+    CRYPTOLIB_HMAC_INSTANTIATE(Sha512)
+#undef CRYPTOLIB_HMAC_INSTANTIATE
+
+} // namespace CryptoLib
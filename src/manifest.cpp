@@ -0,0 +1,194 @@
+#include "manifest.hpp"
+#include "hash_utils.hpp"
+#include "encoding.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace CryptoLib {
+
+    namespace fs = std::filesystem;
+
+    static const char manifest_header[] = "CryptoLib-Manifest v1 sha256";
+    static constexpr std::size_t read_block = 1 << 20; // 1 MiB po čitanju
+
+    struct FileToHash {
+        fs::path full;
+        std::string rel;
+    };
+
+    static std::vector<FileToHash> list_files(const std::string& root) {
+        const fs::path base(root);
+        if (!fs::is_directory(base)) throw std::runtime_error("Nije direktorijum: " + root);
+
+        std::vector<FileToHash> files;
+        for (const auto& entry : fs::recursive_directory_iterator(base)) {
+            if (entry.is_symlink() || !entry.is_regular_file()) continue;
+            files.push_back({ entry.path(), entry.path().lexically_relative(base).generic_u8string() });
+        }
+        std::sort(files.begin(), files.end(),
+                  [](const FileToHash& a, const FileToHash& b) { return a.rel < b.rel; });
+        return files;
+    }
+
+    // Veličina je broj stvarno pročitanih bajtova, pa uvek odgovara heširanom sadržaju
+    static void hash_file(const FileToHash& file, std::vector<char>& buf, ManifestEntry& out) {
+        std::ifstream ifs(file.full, std::ios::binary);
+        if (!ifs) throw std::runtime_error("Ne mogu da otvorim fajl: " + file.rel);
+
+        HashContext<Sha256> ctx;
+        std::uint64_t size = 0;
+        while (ifs) {
+            ifs.read(buf.data(), static_cast<std::streamsize>(buf.size()));
+            const std::size_t got = static_cast<std::size_t>(ifs.gcount());
+            ctx.update(reinterpret_cast<const std::uint8_t*>(buf.data()), got);
+            size += got;
+        }
+        if (ifs.bad()) throw std::runtime_error("Greška pri čitanju fajla: " + file.rel);
+
+        out.path = file.rel;
+        out.size = size;
+        out.digest = ctx.finish();
+    }
+
+    std::vector<ManifestEntry> build_manifest(const std::string& root, unsigned threads) {
+        const std::vector<FileToHash> files = list_files(root);
+        std::vector<ManifestEntry> entries(files.size());
+
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = static_cast<unsigned>(std::min<std::size_t>(threads, std::max<std::size_t>(files.size(), 1)));
+
+        // Niti uzimaju sledeći fajl iz zajedničkog brojača; prvi izuzetak prekida ostale
+        std::atomic<std::size_t> next{ 0 };
+        std::atomic<bool> failed{ false };
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        auto worker = [&] {
+            std::vector<char> buf(read_block);
+            try {
+                while (!failed.load(std::memory_order_relaxed)) {
+                    const std::size_t i = next.fetch_add(1);
+                    if (i >= files.size()) break;
+                    hash_file(files[i], buf, entries[i]);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) error = std::current_exception();
+                failed.store(true);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker);
+        worker();
+        for (auto& th : pool) th.join();
+        if (error) std::rethrow_exception(error);
+        return entries;
+    }
+
+    std::string serialize_manifest(const std::vector<ManifestEntry>& entries) {
+        std::string text = manifest_header;
+        text += '\n';
+        for (const auto& e : entries) {
+            if (e.path.empty() || e.path.find_first_of("\r\n") != std::string::npos)
+                throw std::invalid_argument("serialize_manifest: invalid path: " + e.path);
+            if (e.digest.size() != Sha256::digest_size)
+                throw std::invalid_argument("serialize_manifest: digest must be 32 bytes");
+            text += std::to_string(e.size);
+            text += ' ';
+            text += hex_encode(e.digest);
+            text += ' ';
+            text += e.path;
+            text += '\n';
+        }
+        return text;
+    }
+
+    std::vector<ManifestEntry> parse_manifest(const std::string& text) {
+        auto fail = [](std::size_t line, const char* what) {
+            throw std::invalid_argument("parse_manifest: line " + std::to_string(line) + ": " + what);
+        };
+
+        std::vector<ManifestEntry> entries;
+        std::size_t pos = 0;
+        std::size_t line_no = 0;
+        while (pos < text.size()) {
+            const std::size_t end = text.find('\n', pos);
+            if (end == std::string::npos) fail(line_no + 1, "missing newline");
+            const std::string line = text.substr(pos, end - pos);
+            pos = end + 1;
+
+            if (++line_no == 1) {
+                if (line != manifest_header) fail(line_no, "unknown header");
+                continue;
+            }
+
+            const std::size_t sp1 = line.find(' ');
+            const std::size_t sp2 = sp1 == std::string::npos ? sp1 : line.find(' ', sp1 + 1);
+            if (sp2 == std::string::npos || sp2 + 1 >= line.size()) fail(line_no, "expected <size> <digest> <path>");
+
+            const std::string size = line.substr(0, sp1);
+            if (size.empty() || size.size() > 20 || size.find_first_not_of("0123456789") != std::string::npos)
+                fail(line_no, "invalid size");
+
+            ManifestEntry e;
+            try {
+                e.size = std::stoull(size);
+            } catch (const std::out_of_range&) {
+                fail(line_no, "invalid size");
+            }
+            if (sp2 - sp1 - 1 != 2 * Sha256::digest_size) fail(line_no, "invalid digest length");
+            try {
+                e.digest = hex_decode(line.substr(sp1 + 1, sp2 - sp1 - 1));
+            } catch (const std::invalid_argument&) {
+                fail(line_no, "invalid digest");
+            }
+            e.path = line.substr(sp2 + 1);
+            if (e.path.find('\r') != std::string::npos) fail(line_no, "invalid path");
+            if (!entries.empty() && !(entries.back().path < e.path)) fail(line_no, "paths not sorted or duplicated");
+            entries.push_back(std::move(e));
+        }
+        if (line_no == 0) fail(1, "empty manifest");
+        return entries;
+    }
+
+    SignedManifest sign_directory(const std::string& root, const PrivateKey& priv, unsigned threads) {
+        SignedManifest m;
+        m.text = serialize_manifest(build_manifest(root, threads));
+        m.signature = RSA::sign<Sha256>(m.text, priv);
+        return m;
+    }
+
+    ManifestReport verify_directory(const std::string& root, const SignedManifest& manifest,
+                                    const PublicKey& pub, unsigned threads) {
+        ManifestReport report;
+        report.signature_ok = RSA::verify<Sha256>(manifest.text, manifest.signature, pub);
+        if (!report.signature_ok) return report;
+
+        const std::vector<ManifestEntry> expected = parse_manifest(manifest.text);
+        const std::vector<ManifestEntry> actual = build_manifest(root, threads);
+
+        // Obe liste su sortirane po putanji
+        std::size_t i = 0, j = 0;
+        while (i < expected.size() || j < actual.size()) {
+            if (j == actual.size() || (i < expected.size() && expected[i].path < actual[j].path)) {
+                report.missing.push_back(expected[i++].path);
+            } else if (i == expected.size() || actual[j].path < expected[i].path) {
+                report.added.push_back(actual[j++].path);
+            } else {
+                if (expected[i].size != actual[j].size || expected[i].digest != actual[j].digest)
+                    report.modified.push_back(expected[i].path);
+                ++i;
+                ++j;
+            }
+        }
+        return report;
+    }
+
+} // namespace CryptoLib
@@ -0,0 +1,491 @@
+#include "montgomery.hpp"
+#include "montgomery_kernels.hpp"
+#include "cpu_features.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+namespace CryptoLib {
+
+    using limb_t = boost::multiprecision::limb_type;
+    using dlimb_t = boost::multiprecision::double_limb_type;
+    static constexpr unsigned limb_bits = sizeof(limb_t) * 8;
+
+    bool mont_kernel_supported(MontKernel kernel) {
+        switch (kernel) {
+        case MontKernel::None:
+        case MontKernel::Scalar: return true;
+        case MontKernel::AVX2: return detail::cpu_features().avx2;
+        case MontKernel::IFMA: return detail::cpu_features().avx512_ifma;
+        }
+        return false;
+    }
+
+    MontKernel detect_mont_kernel() {
+        if (mont_kernel_supported(MontKernel::IFMA)) return MontKernel::IFMA;
+        // Sa 64-bitnim limbovima (64x64 -> 128 množenje) skalarni CIOS je brži od AVX2
+        // do 2048 bita; AVX2 se isplati samo kada su limbovi 32-bitni (MSVC)
+        if (limb_bits < 64 && mont_kernel_supported(MontKernel::AVX2)) return MontKernel::AVX2;
+        return MontKernel::Scalar;
+    }
+
+    const char* mont_kernel_name(MontKernel kernel) {
+        switch (kernel) {
+        case MontKernel::None: return "none";
+        case MontKernel::Scalar: return "scalar";
+        case MontKernel::AVX2: return "avx2";
+        case MontKernel::IFMA: return "avx512-ifma";
+        }
+        return "unknown";
+    }
+
+    static std::atomic<MontKernel>& active_kernel() {
+        static std::atomic<MontKernel> k{ detect_mont_kernel() };
+        return k;
+    }
+
+    MontKernel get_mont_kernel() {
+        return active_kernel().load(std::memory_order_relaxed);
+    }
+
+    void set_mont_kernel(MontKernel kernel) {
+        if (!mont_kernel_supported(kernel))
+            throw std::invalid_argument("set_mont_kernel: kernel not supported on this CPU");
+        active_kernel().store(kernel, std::memory_order_relaxed);
+    }
+
+    // ---- Skalarni kernel ----
+
+    // CIOS Montgomery množenje nad punim limbovima (cifre su limb_t smeštene u uint64):
+    // r = a * b * B^(-n) mod m, a, b < m  ->  r < m
+    static void mont_mul_scalar(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                                const std::uint64_t* m, std::uint64_t k0, std::size_t n) {
+        // Mali operandi (do 8192 bita) rade na steku, veći u areni (uvek unutar ArenaScope-a)
+        limb_t stack_buf[136];
+        std::vector<limb_t, ArenaAllocator<limb_t>> heap_buf;
+        limb_t* t = stack_buf;
+        if (n + 2 > sizeof(stack_buf) / sizeof(stack_buf[0])) {
+            heap_buf.resize(n + 2);
+            t = heap_buf.data();
+        }
+        std::fill(t, t + n + 2, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            const dlimb_t bi = static_cast<limb_t>(b[i]);
+            limb_t carry = 0;
+            for (std::size_t j = 0; j < n; ++j) {
+                dlimb_t s = static_cast<limb_t>(a[j]) * bi + t[j] + carry;
+                t[j] = static_cast<limb_t>(s);
+                carry = static_cast<limb_t>(s >> limb_bits);
+            }
+            dlimb_t s = static_cast<dlimb_t>(t[n]) + carry;
+            t[n] = static_cast<limb_t>(s);
+            t[n + 1] = static_cast<limb_t>(s >> limb_bits);
+
+            const dlimb_t y = static_cast<limb_t>(t[0] * static_cast<limb_t>(k0));
+            s = static_cast<limb_t>(m[0]) * y + t[0];
+            carry = static_cast<limb_t>(s >> limb_bits);
+            for (std::size_t j = 1; j < n; ++j) {
+                s = static_cast<limb_t>(m[j]) * y + t[j] + carry;
+                t[j - 1] = static_cast<limb_t>(s);
+                carry = static_cast<limb_t>(s >> limb_bits);
+            }
+            s = static_cast<dlimb_t>(t[n]) + carry;
+            t[n - 1] = static_cast<limb_t>(s);
+            t[n] = t[n + 1] + static_cast<limb_t>(s >> limb_bits);
+            t[n + 1] = 0;
+        }
+
+        // t < 2m: t - m se računa uvek, a bira se maskom (t >= m ako t[n] != 0 ili nema
+        // pozajmice), da vreme ne zavisi od toga da li je oduzimanje potrebno
+        limb_t borrow = 0;
+        for (std::size_t j = 0; j < n; ++j) {
+            const limb_t mj = static_cast<limb_t>(m[j]);
+            const limb_t d = t[j] - mj - borrow;
+            borrow = static_cast<limb_t>(t[j] < mj) | (static_cast<limb_t>(t[j] == mj) & borrow);
+            r[j] = d;
+        }
+        const limb_t use_diff = 0 - (static_cast<limb_t>(t[n] != 0) | (borrow ^ 1));
+        for (std::size_t j = 0; j < n; ++j) r[j] = (static_cast<limb_t>(r[j]) & use_diff) | (t[j] & ~use_diff);
+    }
+
+    // ---- Zajednički deo: zapis cifara i eksponenciranje ----
+
+    using MontMulFn = void (*)(std::uint64_t*, const std::uint64_t*, const std::uint64_t*,
+                               const std::uint64_t*, std::uint64_t, std::size_t);
+    // Izbor ulaza tabele maskom (detail::table_select_*): out, table, entries, rows, idx po traci
+    using SelectFn = void (*)(std::uint64_t*, const std::uint64_t*, std::size_t, std::size_t, const std::size_t*);
+
+    // Skalarni izbor, jedna traka: ulaz ima rows reči
+    static void table_select_scalar(std::uint64_t* out, const std::uint64_t* table, std::size_t entries,
+                                    std::size_t rows, const std::size_t* idx) {
+        std::fill(out, out + rows, 0);
+        for (std::size_t i = 0; i < entries; ++i) {
+            const std::uint64_t mask = 0 - ((static_cast<std::uint64_t>(i ^ idx[0]) - 1) >> 63);
+            const std::uint64_t* e = table + i * rows;
+            for (std::size_t j = 0; j < rows; ++j) out[j] |= e[j] & mask;
+        }
+    }
+
+    struct KernelLayout {
+        MontMulFn mul;
+        SelectFn select;
+        unsigned digit_bits;
+        std::size_t lanes;
+        std::size_t max_digits;
+        unsigned headroom_bits; // redundantni kerneli zahtevaju 2^(w*n) > 4m
+    };
+
+    static KernelLayout layout_for(MontKernel kernel) {
+        switch (kernel) {
+#if defined(CRYPTOLIB_SIMD)
+        case MontKernel::AVX2:
+            return { detail::mont_mul_avx2, detail::table_select_avx2_x4, detail::avx2_digit_bits, detail::avx2_lanes,
+                     detail::avx2_max_digits, 2 };
+        case MontKernel::IFMA:
+            return { detail::mont_mul_ifma, detail::table_select_ifma_x8, detail::ifma_digit_bits, detail::ifma_lanes,
+                     detail::ifma_max_digits, 2 };
+#endif
+        case MontKernel::Scalar:
+            return { mont_mul_scalar, table_select_scalar, limb_bits, 1, static_cast<std::size_t>(-1), 0 };
+        default:
+            throw std::invalid_argument("mont_modexp: kernel not available");
+        }
+    }
+
+    // Cifre, tabela prozora i međurezultati žive u areni tekuće niti: posle prvog poziva
+    // eksponenciranje ne poziva sistemski alokator
+    using DigitVec = std::vector<std::uint64_t, ArenaAllocator<std::uint64_t>>;
+
+    template <class Int>
+    static void to_digits(DigitVec& d, const Int& x, unsigned w, std::size_t n) {
+        d.clear();
+        d.reserve(n);
+        boost::multiprecision::export_bits(x, std::back_inserter(d), w, false);
+        if (d.size() > n) throw std::runtime_error("mont_modexp: value does not fit");
+        d.resize(n, 0);
+    }
+
+    // -m^(-1) mod 2^w (Newton iteracija, svaki korak udvostručuje broj tačnih bitova)
+    static std::uint64_t mont_k0(std::uint64_t m0, unsigned w) {
+        std::uint64_t inv = 1;
+        for (int i = 0; i < 6; ++i) inv *= 2 - m0 * inv;
+        const std::uint64_t mask = (w == 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << w) - 1);
+        return (0 - inv) & mask;
+    }
+
+    // Cifre prozora iz eksponenta; idx zavisi od tajnog eksponenta i koristi se samo kao
+    // maska, nikada kao indeks ili uslov
+    template <class Int>
+    static std::size_t window_at(const Int& exp, std::size_t wi, unsigned win) {
+        std::size_t idx = 0;
+        for (unsigned bit = win; bit-- > 0;)
+            idx = (idx << 1) | static_cast<std::size_t>(bit_test(exp, static_cast<unsigned>(wi * win + bit)));
+        return idx;
+    }
+
+    static unsigned window_bits(std::size_t exp_bits) {
+        if (exp_bits <= 24) return 1;
+        if (exp_bits <= 96) return 3;
+        if (exp_bits <= 384) return 4;
+        if (exp_bits <= 1024) return 5;
+        return 6;
+    }
+
+    template <class Int>
+    static std::size_t digits_for(const KernelLayout& L, const Int& mod) {
+        const std::size_t mod_bits = msb(mod) + 1;
+        std::size_t n = (mod_bits + L.headroom_bits + L.digit_bits - 1) / L.digit_bits;
+        return (n + L.lanes - 1) / L.lanes * L.lanes;
+    }
+
+    template <class Int>
+    static MontKernel kernel_for(const Int& mod) {
+        MontKernel k = get_mont_kernel();
+        if (k == MontKernel::None) k = MontKernel::Scalar;
+        // SIMD kerneli imaju ograničenu veličinu operanada; veći moduli idu na skalarni
+        if (k != MontKernel::Scalar && mod > 0) {
+            const KernelLayout L = layout_for(k);
+            if (digits_for(L, mod) > L.max_digits) k = MontKernel::Scalar;
+        }
+        return k;
+    }
+
+    template <class Int>
+    static Int mont_modexp_impl(const Int& base, const Int& exp, const Int& mod, MontKernel kernel) {
+        if (mod <= 0 || (mod & 1) == 0) throw std::invalid_argument("mont_modexp: mod must be odd and > 0");
+        if (exp < 0) throw std::invalid_argument("mont_modexp: negative exponent");
+        if (!mont_kernel_supported(kernel)) throw std::invalid_argument("mont_modexp: kernel not supported on this CPU");
+        if (mod == 1) return 0;
+
+        const KernelLayout L = layout_for(kernel);
+        const std::size_t n = digits_for(L, mod);
+        if (n > L.max_digits) throw std::invalid_argument("mont_modexp: modulus too large for kernel");
+
+        ArenaScope scope;
+        const unsigned w = L.digit_bits;
+        DigitVec m;
+        to_digits(m, mod, w, n);
+        const std::uint64_t k0 = mont_k0(m[0], w);
+
+        const ArenaBigInt mod_a(mod);
+        ArenaBigInt b(base);
+        b %= mod_a;
+        if (b < 0) b += mod_a;
+
+        // Ulazak u Montgomery domen: x -> x * R mod m, R = 2^(w*n)
+        const std::size_t r_bits = static_cast<std::size_t>(w) * n;
+        ArenaBigInt t = 1;
+        t <<= r_bits;
+        t %= mod_a;
+        DigitVec one_m, base_m;
+        to_digits(one_m, t, w, n);
+        t = b;
+        t <<= r_bits;
+        t %= mod_a;
+        to_digits(base_m, t, w, n);
+
+        // Tabela base^0 .. base^(2^win - 1) u Montgomery domenu, jedan uzastopni blok
+        const std::size_t exp_bits = exp == 0 ? 0 : msb(exp) + 1;
+        const unsigned win = window_bits(exp_bits);
+        const std::size_t entries = std::size_t(1) << win;
+        DigitVec table(entries * n);
+        auto entry = [&](std::size_t i) { return table.data() + i * n; };
+        std::copy(one_m.begin(), one_m.end(), entry(0));
+        std::copy(base_m.begin(), base_m.end(), entry(1));
+        for (std::size_t i = 2; i < entries; ++i) L.mul(entry(i), entry(i - 1), base_m.data(), m.data(), k0, n);
+
+        // Fiksni prozor od najviših bitova eksponenta. Množi se u svakom prozoru (i sa base^0),
+        // a ulaz tabele se bira čitanjem svih ulaza pod maskom: niz operacija i pristupa
+        // memoriji zavisi samo od dužine eksponenta, ne od njegovih bitova.
+        DigitVec acc(one_m), pick(n);
+        const std::size_t windows = (exp_bits + win - 1) / win;
+        for (std::size_t wi = windows; wi-- > 0;) {
+            if (wi + 1 != windows) {
+                for (unsigned s = 0; s < win; ++s) L.mul(acc.data(), acc.data(), acc.data(), m.data(), k0, n);
+            }
+            // Isti idx u svim trakama: table_select_* tada bira ceo ulaz od n reči
+            std::size_t idx[16];
+            std::fill(idx, idx + L.lanes, window_at(exp, wi, win));
+            L.select(pick.data(), table.data(), entries, n / L.lanes, idx);
+            L.mul(acc.data(), acc.data(), pick.data(), m.data(), k0, n);
+        }
+
+        // Izlazak iz domena: acc * 1 * R^(-1); redundantni kerneli daju rezultat <= m
+        DigitVec plain_one(n, 0);
+        plain_one[0] = 1;
+        L.mul(acc.data(), acc.data(), plain_one.data(), m.data(), k0, n);
+        Int result;
+        boost::multiprecision::import_bits(result, acc.begin(), acc.end(), w, false);
+        while (result >= mod) result -= mod;
+        return result;
+    }
+
+    // ---- Multi-buffer: više nezavisnih eksponenciranja u trakama jednog vektora ----
+
+    using MultiMulFn = void (*)(std::uint64_t*, const std::uint64_t*, const std::uint64_t*,
+                                const std::uint64_t*, const std::uint64_t*, std::size_t);
+
+    struct BatchLayout {
+        MultiMulFn mul = nullptr; // nullptr = nema multi-buffer kernela, ulazi idu jedan po jedan
+        SelectFn select = nullptr;
+        unsigned digit_bits = 0;
+        std::size_t lanes = 1;
+        std::size_t max_digits = 0;
+    };
+
+    // Prati izabrani kernel: IFMA -> 8 traka, AVX2 -> 4 trake. Skalarni kernel nema
+    // multi-buffer varijantu; ako je AVX2 dostupan, x4 kernel je i tada brži po operaciji.
+    static BatchLayout batch_layout() {
+        BatchLayout B;
+#if defined(CRYPTOLIB_SIMD)
+        const MontKernel k = get_mont_kernel();
+        if (k == MontKernel::IFMA) {
+            B = { detail::mont_mul_ifma_x8, detail::table_select_ifma_x8, detail::ifma_digit_bits, detail::ifma_lanes,
+                  detail::ifma_max_digits };
+        } else if (k != MontKernel::None && mont_kernel_supported(MontKernel::AVX2)) {
+            B = { detail::mont_mul_avx2_x4, detail::table_select_avx2_x4, detail::avx2_digit_bits, detail::avx2_lanes,
+                  detail::avx2_max_digits };
+        }
+#endif
+        return B;
+    }
+
+    std::size_t mont_batch_lanes() {
+        return batch_layout().lanes;
+    }
+
+    // Jedan prolaz nad najviše B.lanes ulaza; prazne trake ponavljaju traku 0 i odbacuju se.
+    // Svi moduli su neparni i > 1 i staju u n cifara. Sve trake rade isti niz kvadriranja i
+    // množenja (eksponenti se dopunjuju nulama do najdužeg), razlikuje se samo ulaz iz tabele.
+    template <class Int>
+    static void mont_modexp_lanes(const BatchLayout& B, const Int* const* base, const Int* const* exp,
+                                  const Int* const* mod, Int** out, std::size_t count, std::size_t n) {
+        const std::size_t L = B.lanes;
+        const unsigned w = B.digit_bits;
+        const std::size_t r_bits = static_cast<std::size_t>(w) * n;
+        auto src = [&](std::size_t l) { return l < count ? l : 0; };
+
+        DigitVec m(n * L), one_m(n * L), base_m(n * L), d;
+        std::uint64_t k0[16];
+        std::size_t exp_bits = 0;
+        ArenaBigInt t;
+        for (std::size_t l = 0; l < L; ++l) {
+            const std::size_t s = src(l);
+            const ArenaBigInt mod_a(*mod[s]);
+            auto scatter = [&](DigitVec& soa, const ArenaBigInt& x) {
+                to_digits(d, x, w, n);
+                for (std::size_t j = 0; j < n; ++j) soa[j * L + l] = d[j];
+            };
+            scatter(m, mod_a);
+            k0[l] = mont_k0(d[0], w);
+
+            t = 1;
+            t <<= r_bits;
+            t %= mod_a;
+            scatter(one_m, t);
+            t = ArenaBigInt(*base[s]) % mod_a;
+            if (t < 0) t += mod_a;
+            t <<= r_bits;
+            t %= mod_a;
+            scatter(base_m, t);
+
+            if (*exp[s] != 0) exp_bits = std::max<std::size_t>(exp_bits, msb(*exp[s]) + 1);
+        }
+
+        // Izbor maskom čita celu tabelu u svakom prozoru; tabela od L traka sa 6-bitnim
+        // prozorom (160 KB za 2048 bita i 8 traka) ne staje u L1, a sa 4-bitnim staje, pa su
+        // nešto brojnija množenja jeftinija od čitanja
+        const unsigned win = std::min(window_bits(exp_bits), 4u);
+        const std::size_t entries = std::size_t(1) << win;
+        const std::size_t stride = n * L;
+        DigitVec table(entries * stride);
+        auto entry = [&](std::size_t i) { return table.data() + i * stride; };
+        std::copy(one_m.begin(), one_m.end(), entry(0));
+        std::copy(base_m.begin(), base_m.end(), entry(1));
+        for (std::size_t i = 2; i < entries; ++i) B.mul(entry(i), entry(i - 1), base_m.data(), m.data(), k0, n);
+
+        DigitVec acc(one_m), pick(stride);
+        const std::size_t windows = (exp_bits + win - 1) / win;
+        for (std::size_t wi = windows; wi-- > 0;) {
+            if (wi + 1 != windows) {
+                for (unsigned s = 0; s < win; ++s) B.mul(acc.data(), acc.data(), acc.data(), m.data(), k0, n);
+            }
+            // Svaka traka uzima svoj ulaz tabele, izbor maskom kao u mont_modexp_impl; množi
+            // se i sa base^0 da bi trake ostale u koraku
+            std::size_t idx[16];
+            for (std::size_t l = 0; l < L; ++l) idx[l] = window_at(*exp[src(l)], wi, win);
+            B.select(pick.data(), table.data(), entries, n, idx);
+            B.mul(acc.data(), acc.data(), pick.data(), m.data(), k0, n);
+        }
+
+        DigitVec plain_one(stride, 0);
+        std::fill(plain_one.begin(), plain_one.begin() + L, 1);
+        B.mul(acc.data(), acc.data(), plain_one.data(), m.data(), k0, n);
+        for (std::size_t l = 0; l < count; ++l) {
+            d.resize(n);
+            for (std::size_t j = 0; j < n; ++j) d[j] = acc[j * L + l];
+            Int& r = *out[l];
+            boost::multiprecision::import_bits(r, d.begin(), d.end(), w, false);
+            while (r >= *mod[l]) r -= *mod[l];
+        }
+    }
+
+    // Ulazi koje multi-buffer kernel ne pokriva (modul prevelik, paran ili 1, negativan
+    // eksponent) idu kroz mont_modexp_impl pojedinačno, sa istim izuzecima kao mont_modexp
+    template <class Int>
+    static void mont_modexp_batch_impl(const Int* base, const Int* exp, const Int* mod, Int* out,
+                                       std::size_t count, std::size_t exp_stride, std::size_t mod_stride) {
+        ArenaScope scope;
+        const BatchLayout B = batch_layout();
+        std::vector<std::size_t, ArenaAllocator<std::size_t>> batched;
+        for (std::size_t i = 0; i < count; ++i) {
+            const Int& e = exp[i * exp_stride];
+            const Int& m = mod[i * mod_stride];
+            const bool fits = B.mul && m > 1 && (m & 1) != 0 && e >= 0 &&
+                              (msb(m) + 1 + 2 + B.digit_bits - 1) / B.digit_bits <= B.max_digits;
+            if (fits) batched.push_back(i);
+            else out[i] = mont_modexp_impl(base[i], e, m, kernel_for(m));
+        }
+
+        // Trake jednog prolaza treba da budu slične dužine: sortiranje po veličini modula
+        // (std::sort, jer stable_sort alocira privremeni bafer van arene)
+        std::sort(batched.begin(), batched.end(), [&](std::size_t x, std::size_t y) {
+            const std::size_t bx = msb(mod[x * mod_stride]), by = msb(mod[y * mod_stride]);
+            return bx != by ? bx < by : x < y;
+        });
+        const Int* pb[16];
+        const Int* pe[16];
+        const Int* pm[16];
+        Int* po[16];
+        for (std::size_t first = 0; first < batched.size(); first += B.lanes) {
+            const std::size_t cnt = std::min(B.lanes, batched.size() - first);
+            if (cnt == 1) {
+                const std::size_t i = batched[first];
+                out[i] = mont_modexp_impl(base[i], exp[i * exp_stride], mod[i * mod_stride], kernel_for(mod[i * mod_stride]));
+                continue;
+            }
+            std::size_t n = 0;
+            for (std::size_t l = 0; l < cnt; ++l) {
+                const std::size_t i = batched[first + l];
+                pb[l] = &base[i];
+                pe[l] = &exp[i * exp_stride];
+                pm[l] = &mod[i * mod_stride];
+                po[l] = &out[i];
+                n = std::max<std::size_t>(n, (msb(*pm[l]) + 1 + 2 + B.digit_bits - 1) / B.digit_bits);
+            }
+            mont_modexp_lanes(B, pb, pe, pm, po, cnt, n);
+        }
+    }
+
+    std::vector<BigInt> mont_modexp_batch(const std::vector<BigInt>& bases, const std::vector<BigInt>& exps,
+                                          const std::vector<BigInt>& mods) {
+        const std::size_t count = bases.size();
+        if ((exps.size() != count && exps.size() != 1) || (mods.size() != count && mods.size() != 1))
+            throw std::invalid_argument("mont_modexp_batch: size mismatch");
+        std::vector<BigInt> out(count);
+        if (count == 0) return out;
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        ArenaScope scope;
+        std::vector<ArenaBigInt, ArenaAllocator<ArenaBigInt>> b(bases.begin(), bases.end()),
+            e(exps.begin(), exps.end()), m(mods.begin(), mods.end()), r(count);
+        mont_modexp_batch_impl(b.data(), e.data(), m.data(), r.data(), count, e.size() == 1 ? 0 : 1, m.size() == 1 ? 0 : 1);
+        for (std::size_t i = 0; i < count; ++i) out[i] = BigInt(r[i]);
+#else
+        mont_modexp_batch_impl(bases.data(), exps.data(), mods.data(), out.data(), count,
+                               exps.size() == 1 ? 0 : 1, mods.size() == 1 ? 0 : 1);
+#endif
+        return out;
+    }
+
+    void mont_modexp_batch_arena(const ArenaBigInt* bases, const ArenaBigInt& exp, const ArenaBigInt& mod,
+                                 ArenaBigInt* out, std::size_t count) {
+        mont_modexp_batch_impl(bases, &exp, &mod, out, count, 0, 0);
+    }
+
+#if defined(CRYPTOLIB_BIGINT_GMP)
+    // Kerneli rade nad cpp_int limbovima; mpz vrednosti se konvertuju na ulazu i izlazu
+    BigInt mont_modexp(const BigInt& base, const BigInt& exp, const BigInt& mod, MontKernel kernel) {
+        ArenaScope scope;
+        return BigInt(mont_modexp_impl(ArenaBigInt(base), ArenaBigInt(exp), ArenaBigInt(mod), kernel));
+    }
+
+    BigInt mont_modexp(const BigInt& base, const BigInt& exp, const BigInt& mod) {
+        return mont_modexp(base, exp, mod, kernel_for(mod));
+    }
+#else
+    BigInt mont_modexp(const BigInt& base, const BigInt& exp, const BigInt& mod) {
+        return mont_modexp_impl(base, exp, mod, kernel_for(mod));
+    }
+
+    BigInt mont_modexp(const BigInt& base, const BigInt& exp, const BigInt& mod, MontKernel kernel) {
+        return mont_modexp_impl(base, exp, mod, kernel);
+    }
+#endif
+
+    ArenaBigInt mont_modexp_arena(const ArenaBigInt& base, const ArenaBigInt& exp, const ArenaBigInt& mod) {
+        return mont_modexp_impl(base, exp, mod, kernel_for(mod));
+    }
+
+} // namespace CryptoLib
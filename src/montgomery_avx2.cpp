@@ -0,0 +1,170 @@
+#include "montgomery_kernels.hpp"
+#include <immintrin.h>
+#include <stdexcept>
+
+namespace CryptoLib {
+namespace detail {
+
+    static constexpr std::uint64_t mask29 = (std::uint64_t(1) << avx2_digit_bits) - 1;
+
+    // Svaka iteracija dodaje najviše 2 * 2^58 po traci; posle 16 iteracija cifre se
+    // normalizuju da ne bi došlo do prekoračenja 64 bita
+    static constexpr std::size_t avx2_normalize_every = 16;
+
+    // [x0,x1,x2,x3] -> [x1,x2,x3,next0]
+    static inline __m256i shift_down(__m256i x, __m256i next) {
+        __m256i xr = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(0, 3, 2, 1));
+        __m256i nr = _mm256_permute4x64_epi64(next, _MM_SHUFFLE(0, 3, 2, 1));
+        return _mm256_blend_epi32(xr, nr, 0xC0);
+    }
+
+    // [x0,x1,x2,x3] -> [prev3,x0,x1,x2]
+    static inline __m256i shift_up(__m256i x, __m256i prev) {
+        __m256i xr = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 1, 0, 3));
+        __m256i pr = _mm256_permute4x64_epi64(prev, _MM_SHUFFLE(2, 1, 0, 3));
+        return _mm256_blend_epi32(xr, pr, 0x03);
+    }
+
+    template <std::size_t NR>
+    static void normalize29(__m256i (&acc)[NR]) {
+        const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(mask29));
+        __m256i carry[NR];
+        for (std::size_t k = 0; k < NR; ++k) {
+            carry[k] = _mm256_srli_epi64(acc[k], avx2_digit_bits);
+            acc[k] = _mm256_and_si256(acc[k], mask);
+        }
+        const __m256i zero = _mm256_setzero_si256();
+        for (std::size_t k = NR; k-- > 0;) {
+            acc[k] = _mm256_add_epi64(acc[k], shift_up(carry[k], k > 0 ? carry[k - 1] : zero));
+        }
+    }
+
+    // Montgomery množenje sa punim 29x29 -> 58-bitnim proizvodima (_mm256_mul_epu32)
+    template <std::size_t NR>
+    static void amm29(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                      const std::uint64_t* m, std::uint64_t k0) {
+        constexpr std::size_t n = NR * avx2_lanes;
+        __m256i acc[NR];
+        for (std::size_t k = 0; k < NR; ++k) acc[k] = _mm256_setzero_si256();
+        const __m256i zero = _mm256_setzero_si256();
+        const std::uint64_t m0 = m[0];
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const __m256i bi = _mm256_set1_epi64x(static_cast<long long>(b[i]));
+            for (std::size_t k = 0; k < NR; ++k) {
+                __m256i ak = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + k * avx2_lanes));
+                acc[k] = _mm256_add_epi64(acc[k], _mm256_mul_epu32(ak, bi));
+            }
+
+            const std::uint64_t acc0 = static_cast<std::uint64_t>(_mm_cvtsi128_si64(_mm256_castsi256_si128(acc[0])));
+            const std::uint64_t y = (acc0 * k0) & mask29;
+            const std::uint64_t carry = (acc0 + m0 * y) >> avx2_digit_bits;
+            const __m256i yv = _mm256_set1_epi64x(static_cast<long long>(y));
+            for (std::size_t k = 0; k < NR; ++k) {
+                __m256i mk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + k * avx2_lanes));
+                acc[k] = _mm256_add_epi64(acc[k], _mm256_mul_epu32(mk, yv));
+            }
+
+            for (std::size_t k = 0; k + 1 < NR; ++k) acc[k] = shift_down(acc[k], acc[k + 1]);
+            acc[NR - 1] = shift_down(acc[NR - 1], zero);
+            acc[0] = _mm256_add_epi64(acc[0], _mm256_set_epi64x(0, 0, 0, static_cast<long long>(carry)));
+
+            if ((i + 1) % avx2_normalize_every == 0) normalize29(acc);
+        }
+
+        alignas(32) std::uint64_t t[n];
+        for (std::size_t k = 0; k < NR; ++k)
+            _mm256_store_si256(reinterpret_cast<__m256i*>(t + k * avx2_lanes), acc[k]);
+        std::uint64_t c = 0;
+        for (std::size_t j = 0; j < n; ++j) {
+            std::uint64_t v = t[j] + c;
+            r[j] = v & mask29;
+            c = v >> avx2_digit_bits;
+        }
+    }
+
+    // Bira instancu šablona za n / 4 registara
+    template <std::size_t NR>
+    static void dispatch29(std::size_t nr, std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                           const std::uint64_t* m, std::uint64_t k0) {
+        if (nr == NR) amm29<NR>(r, a, b, m, k0);
+        else if constexpr (NR * avx2_lanes < avx2_max_digits) dispatch29<NR + 1>(nr, r, a, b, m, k0);
+        else throw std::invalid_argument("mont_mul_avx2: unsupported operand size");
+    }
+
+    void mont_mul_avx2(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                       const std::uint64_t* m, std::uint64_t k0, std::size_t n) {
+        if (n == 0 || n % avx2_lanes != 0) throw std::invalid_argument("mont_mul_avx2: unsupported operand size");
+        dispatch29<1>(n / avx2_lanes, r, a, b, m, k0);
+    }
+
+    // Multi-buffer: traka l računa svoje množenje nezavisno, pa nema pomeranja između traka.
+    // t[j] je cifra j akumulatora za sve četiri trake; pomeranje za cifru je pomeranje indeksa.
+    void mont_mul_avx2_x4(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                          const std::uint64_t* m, const std::uint64_t* k0, std::size_t n) {
+        if (n == 0 || n > avx2_max_digits) throw std::invalid_argument("mont_mul_avx2_x4: unsupported operand size");
+        constexpr std::size_t L = avx2_lanes;
+        auto load = [](const std::uint64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); };
+        const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(mask29));
+        const __m256i K0 = load(k0);
+        const __m256i zero = _mm256_setzero_si256();
+
+        __m256i t[avx2_max_digits];
+        for (std::size_t j = 0; j < n; ++j) t[j] = zero;
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const __m256i bi = load(b + i * L);
+            __m256i t0 = _mm256_add_epi64(t[0], _mm256_mul_epu32(load(a), bi));
+            const __m256i y = _mm256_and_si256(_mm256_mul_epu32(_mm256_and_si256(t0, mask), K0), mask);
+            t0 = _mm256_add_epi64(t0, _mm256_mul_epu32(load(m), y));
+            const __m256i carry = _mm256_srli_epi64(t0, avx2_digit_bits);
+
+            for (std::size_t j = 1; j < n; ++j) {
+                __m256i s = _mm256_add_epi64(t[j], _mm256_mul_epu32(load(a + j * L), bi));
+                t[j - 1] = _mm256_add_epi64(s, _mm256_mul_epu32(load(m + j * L), y));
+            }
+            t[n - 1] = zero;
+            t[0] = _mm256_add_epi64(t[0], carry);
+
+            if ((i + 1) % avx2_normalize_every == 0) {
+                __m256i c = zero;
+                for (std::size_t j = 0; j + 1 < n; ++j) {
+                    const __m256i v = _mm256_add_epi64(t[j], c);
+                    t[j] = _mm256_and_si256(v, mask);
+                    c = _mm256_srli_epi64(v, avx2_digit_bits);
+                }
+                t[n - 1] = _mm256_add_epi64(t[n - 1], c);
+            }
+        }
+
+        __m256i c = zero;
+        for (std::size_t j = 0; j < n; ++j) {
+            const __m256i v = _mm256_add_epi64(t[j], c);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + j * L), _mm256_and_si256(v, mask));
+            c = _mm256_srli_epi64(v, avx2_digit_bits);
+        }
+    }
+
+    void table_select_avx2_x4(std::uint64_t* out, const std::uint64_t* table, std::size_t entries,
+                              std::size_t rows, const std::size_t* idx) {
+        if (entries > max_table_entries) throw std::invalid_argument("table_select_avx2_x4: table too large");
+        constexpr std::size_t L = avx2_lanes;
+        const __m256i iv = _mm256_set_epi64x(static_cast<long long>(idx[3]), static_cast<long long>(idx[2]),
+                                             static_cast<long long>(idx[1]), static_cast<long long>(idx[0]));
+        __m256i k[max_table_entries];
+        for (std::size_t i = 0; i < entries; ++i)
+            k[i] = _mm256_cmpeq_epi64(iv, _mm256_set1_epi64x(static_cast<long long>(i)));
+
+        const std::size_t stride = rows * L;
+        for (std::size_t r = 0; r < rows; ++r) {
+            __m256i acc = _mm256_setzero_si256();
+            for (std::size_t i = 0; i < entries; ++i) {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table + i * stride + r * L));
+                acc = _mm256_or_si256(acc, _mm256_and_si256(v, k[i]));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + r * L), acc);
+        }
+    }
+
+} // namespace detail
+} // namespace CryptoLib
@@ -0,0 +1,155 @@
+#include "montgomery_kernels.hpp"
+#include <stdexcept>
+
+// GCC 12 avx512fintrin.h pravi nedefinisane vektore (__Y) za _mm512_alignr_epi64 i
+// _mm512_extracti32x4_epi32, pa -Wall posle inline-ovanja prijavljuje -W(maybe-)uninitialized
+// u zaglavlju (GCC PR 105593, ispravljeno u kasnijim izdanjima). Upozorenje se vezuje za liniju zaglavlja,
+// pa se isključuje oko #include i celog fajla, samo za te dve dijagnostike.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+
+namespace CryptoLib {
+namespace detail {
+
+    static constexpr std::uint64_t mask52 = (std::uint64_t(1) << ifma_digit_bits) - 1;
+
+    // Almost Montgomery Multiplication (Gueron-Krasnov) sa NR zmm akumulatora.
+    // U svakoj iteraciji: acc += a*b[i] + m*y (niži delovi), pomeranje za jednu cifru,
+    // pa se dodaju viši delovi proizvoda koji posle pomeranja padaju na isti indeks.
+    template <std::size_t NR>
+    static void amm52(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                      const std::uint64_t* m, std::uint64_t k0) {
+        constexpr std::size_t n = NR * ifma_lanes;
+        __m512i A[NR], M[NR], acc[NR];
+        for (std::size_t k = 0; k < NR; ++k) {
+            A[k] = _mm512_loadu_si512(a + k * ifma_lanes);
+            M[k] = _mm512_loadu_si512(m + k * ifma_lanes);
+            acc[k] = _mm512_setzero_si512();
+        }
+        const __m512i zero = _mm512_setzero_si512();
+        const std::uint64_t m0 = m[0];
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const __m512i bi = _mm512_set1_epi64(static_cast<long long>(b[i]));
+            for (std::size_t k = 0; k < NR; ++k) acc[k] = _mm512_madd52lo_epu64(acc[k], A[k], bi);
+
+            const std::uint64_t acc0 = static_cast<std::uint64_t>(_mm_cvtsi128_si64(_mm512_castsi512_si128(acc[0])));
+            const std::uint64_t y = (acc0 * k0) & mask52;
+            const std::uint64_t carry = (acc0 + ((m0 * y) & mask52)) >> ifma_digit_bits;
+            const __m512i yv = _mm512_set1_epi64(static_cast<long long>(y));
+            for (std::size_t k = 0; k < NR; ++k) acc[k] = _mm512_madd52lo_epu64(acc[k], M[k], yv);
+
+            // Pomeranje za jednu 64-bitnu traku naniže kroz ceo lanac registara
+            for (std::size_t k = 0; k + 1 < NR; ++k) acc[k] = _mm512_alignr_epi64(acc[k + 1], acc[k], 1);
+            acc[NR - 1] = _mm512_alignr_epi64(zero, acc[NR - 1], 1);
+            acc[0] = _mm512_add_epi64(acc[0], _mm512_maskz_set1_epi64(1, static_cast<long long>(carry)));
+
+            for (std::size_t k = 0; k < NR; ++k) {
+                acc[k] = _mm512_madd52hi_epu64(acc[k], A[k], bi);
+                acc[k] = _mm512_madd52hi_epu64(acc[k], M[k], yv);
+            }
+        }
+
+        // Cifre su redundantne (do ~61 bita); normalizacija na 52 bita
+        alignas(64) std::uint64_t t[n];
+        for (std::size_t k = 0; k < NR; ++k) _mm512_store_si512(t + k * ifma_lanes, acc[k]);
+        std::uint64_t c = 0;
+        for (std::size_t j = 0; j < n; ++j) {
+            std::uint64_t v = t[j] + c;
+            r[j] = v & mask52;
+            c = v >> ifma_digit_bits;
+        }
+    }
+
+    // Bira instancu šablona za n / 8 registara
+    template <std::size_t NR>
+    static void dispatch52(std::size_t nr, std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                           const std::uint64_t* m, std::uint64_t k0) {
+        if (nr == NR) amm52<NR>(r, a, b, m, k0);
+        else if constexpr (NR * ifma_lanes < ifma_max_digits) dispatch52<NR + 1>(nr, r, a, b, m, k0);
+        else throw std::invalid_argument("mont_mul_ifma: unsupported operand size");
+    }
+
+    void mont_mul_ifma(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                       const std::uint64_t* m, std::uint64_t k0, std::size_t n) {
+        if (n == 0 || n % ifma_lanes != 0) throw std::invalid_argument("mont_mul_ifma: unsupported operand size");
+        dispatch52<1>(n / ifma_lanes, r, a, b, m, k0);
+    }
+
+    // Multi-buffer: osam nezavisnih množenja, po jedno u svakoj traci. Niži deo proizvoda
+    // cifre j posle pomeranja pada na j - 1, viši na j, pa se oba sabiraju u istom prolazu.
+    // Po iteraciji cifra raste najviše 4 * 2^52, pa do 80 cifara nema prekoračenja.
+    void mont_mul_ifma_x8(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                          const std::uint64_t* m, const std::uint64_t* k0, std::size_t n) {
+        if (n == 0 || n > ifma_max_digits) throw std::invalid_argument("mont_mul_ifma_x8: unsupported operand size");
+        constexpr std::size_t L = ifma_lanes;
+        const __m512i mask = _mm512_set1_epi64(static_cast<long long>(mask52));
+        const __m512i K0 = _mm512_loadu_si512(k0);
+        const __m512i zero = _mm512_setzero_si512();
+
+        __m512i t[ifma_max_digits];
+        for (std::size_t j = 0; j < n; ++j) t[j] = zero;
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const __m512i bi = _mm512_loadu_si512(b + i * L);
+            __m512i pa = _mm512_loadu_si512(a);
+            __m512i pm = _mm512_loadu_si512(m);
+            __m512i t0 = _mm512_madd52lo_epu64(t[0], pa, bi);
+            const __m512i y = _mm512_madd52lo_epu64(zero, _mm512_and_si512(t0, mask), K0); // t0 * k0 mod 2^52
+            t0 = _mm512_madd52lo_epu64(t0, pm, y);
+            const __m512i carry = _mm512_srli_epi64(t0, ifma_digit_bits);
+
+            for (std::size_t j = 1; j < n; ++j) {
+                const __m512i aj = _mm512_loadu_si512(a + j * L);
+                const __m512i mj = _mm512_loadu_si512(m + j * L);
+                __m512i s = _mm512_madd52lo_epu64(t[j], aj, bi);
+                s = _mm512_madd52lo_epu64(s, mj, y);
+                s = _mm512_madd52hi_epu64(s, pa, bi);
+                t[j - 1] = _mm512_madd52hi_epu64(s, pm, y);
+                pa = aj;
+                pm = mj;
+            }
+            t[n - 1] = _mm512_madd52hi_epu64(_mm512_madd52hi_epu64(zero, pa, bi), pm, y);
+            t[0] = _mm512_add_epi64(t[0], carry);
+        }
+
+        __m512i c = zero;
+        for (std::size_t j = 0; j < n; ++j) {
+            const __m512i v = _mm512_add_epi64(t[j], c);
+            _mm512_storeu_si512(r + j * L, _mm512_and_si512(v, mask));
+            c = _mm512_srli_epi64(v, ifma_digit_bits);
+        }
+    }
+
+    void table_select_ifma_x8(std::uint64_t* out, const std::uint64_t* table, std::size_t entries,
+                              std::size_t rows, const std::size_t* idx) {
+        if (entries > max_table_entries) throw std::invalid_argument("table_select_ifma_x8: table too large");
+        constexpr std::size_t L = ifma_lanes;
+        const __m512i iv = _mm512_set_epi64(
+            static_cast<long long>(idx[7]), static_cast<long long>(idx[6]), static_cast<long long>(idx[5]),
+            static_cast<long long>(idx[4]), static_cast<long long>(idx[3]), static_cast<long long>(idx[2]),
+            static_cast<long long>(idx[1]), static_cast<long long>(idx[0]));
+        __mmask8 k[max_table_entries];
+        for (std::size_t i = 0; i < entries; ++i)
+            k[i] = _mm512_cmpeq_epi64_mask(iv, _mm512_set1_epi64(static_cast<long long>(i)));
+
+        // Ceo red se uvek učitava, pa se maskira (maskirano učitavanje bi moglo da preskoči pristup)
+        const std::size_t stride = rows * L;
+        for (std::size_t r = 0; r < rows; ++r) {
+            __m512i acc = _mm512_setzero_si512();
+            for (std::size_t i = 0; i < entries; ++i)
+                acc = _mm512_or_si512(acc, _mm512_maskz_mov_epi64(k[i], _mm512_loadu_si512(table + i * stride + r * L)));
+            _mm512_storeu_si512(out + r * L, acc);
+        }
+    }
+
+} // namespace detail
+} // namespace CryptoLib
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
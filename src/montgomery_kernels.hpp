@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Interni SIMD kerneli za Montgomery množenje (montgomery_avx2.cpp, montgomery_ifma.cpp).
+// Sve funkcije računaju r = a * b * 2^(-w*n) mod m u redundantnom zapisu sa w-bitnim
+// ciframa (w = 29 za AVX2, 52 za IFMA): ulazi su normalizovani i < 2m, 2^(w*n) > 4m,
+// izlaz je normalizovan i < 2m. k0 = -m^(-1) mod 2^w. r sme da se poklapa sa a ili b.
+
+namespace CryptoLib {
+namespace detail {
+
+    constexpr unsigned avx2_digit_bits = 29;
+    constexpr std::size_t avx2_lanes = 4;
+    constexpr std::size_t avx2_max_digits = 144; // 4176 bita
+
+    constexpr unsigned ifma_digit_bits = 52;
+    constexpr std::size_t ifma_lanes = 8;
+    constexpr std::size_t ifma_max_digits = 80;  // 4160 bita
+
+    // n mora biti deljivo brojem lanova i <= max_digits
+    void mont_mul_avx2(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                       const std::uint64_t* m, std::uint64_t k0, std::size_t n);
+    void mont_mul_ifma(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                       const std::uint64_t* m, std::uint64_t k0, std::size_t n);
+
+    // Multi-buffer varijante: `lanes` nezavisnih množenja u istom prolazu, svako u svojoj
+    // traci vektora i sa svojim modulom. Zapis je struktura nizova: cifra j trake l je na
+    // x[j * lanes + l], k0[l] je konstanta modula trake l. Uslovi po traci su isti kao gore;
+    // n je proizvoljno do max_digits (ne mora biti deljivo brojem traka).
+    void mont_mul_avx2_x4(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                          const std::uint64_t* m, const std::uint64_t* k0, std::size_t n);
+    void mont_mul_ifma_x8(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t* b,
+                          const std::uint64_t* m, const std::uint64_t* k0, std::size_t n);
+
+    // Ulaz tabele bez pristupa memoriji koji zavisi od indeksa (indeks je deo tajnog
+    // eksponenta): traka l dobija ulaz idx[l]. Ulaz ima rows * lanes reči u istom zapisu kao
+    // gore; čitaju se svi ulazi, a traka bira maskom. Za jedno množenje (n reči, deljivo
+    // brojem traka) svi idx[l] su isti i rows = n / lanes. entries <= max_table_entries.
+    constexpr std::size_t max_table_entries = 64;
+    void table_select_avx2_x4(std::uint64_t* out, const std::uint64_t* table, std::size_t entries,
+                              std::size_t rows, const std::size_t* idx);
+    void table_select_ifma_x8(std::uint64_t* out, const std::uint64_t* table, std::size_t entries,
+                              std::size_t rows, const std::size_t* idx);
+
+} // namespace detail
+} // namespace CryptoLib
@@ -0,0 +1,304 @@
+#include "mul_utils.hpp"
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace CryptoLib {
+
+    using limb_t = boost::multiprecision::limb_type;
+    using dlimb_t = boost::multiprecision::double_limb_type;
+#if defined(CRYPTOLIB_BIGINT_GMP)
+    // limb_count broji GMP limbove, pa Barrett mora da radi u istoj osnovi
+    static constexpr unsigned limb_bits = GMP_NUMB_BITS;
+#else
+    static constexpr unsigned limb_bits = sizeof(limb_t) * 8;
+#endif
+
+    static std::atomic<std::size_t> g_karatsuba_mul{ MulThresholds{}.karatsuba_mul };
+    static std::atomic<std::size_t> g_karatsuba_sqr{ MulThresholds{}.karatsuba_sqr };
+    static std::atomic<std::size_t> g_barrett{ MulThresholds{}.barrett };
+
+    MulThresholds get_mul_thresholds() {
+        MulThresholds t;
+        t.karatsuba_mul = g_karatsuba_mul.load(std::memory_order_relaxed);
+        t.karatsuba_sqr = g_karatsuba_sqr.load(std::memory_order_relaxed);
+        t.barrett = g_barrett.load(std::memory_order_relaxed);
+        return t;
+    }
+
+    void set_mul_thresholds(const MulThresholds& t) {
+        // Karatsuba rekurzija zahteva bar nekoliko limbova po polovini
+        if (t.karatsuba_mul < 8 || t.karatsuba_sqr < 8)
+            throw std::invalid_argument("set_mul_thresholds: karatsuba threshold must be >= 8");
+        g_karatsuba_mul.store(t.karatsuba_mul, std::memory_order_relaxed);
+        g_karatsuba_sqr.store(t.karatsuba_sqr, std::memory_order_relaxed);
+        g_barrett.store(t.barrett, std::memory_order_relaxed);
+    }
+
+    std::size_t limb_count(const BigInt& x) {
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        return mpz_size(x.backend().data());
+#else
+        return x == 0 ? 0 : x.backend().size();
+#endif
+    }
+
+#if !defined(CRYPTOLIB_BIGINT_GMP)
+
+    // ---- Operacije nad nizovima limbova (little-endian) ----
+
+    static limb_t add_n(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n) {
+        limb_t carry = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            dlimb_t t = static_cast<dlimb_t>(a[i]) + b[i] + carry;
+            r[i] = static_cast<limb_t>(t);
+            carry = static_cast<limb_t>(t >> limb_bits);
+        }
+        return carry;
+    }
+
+    static limb_t sub_n(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n) {
+        limb_t borrow = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            limb_t ai = a[i], bi = b[i];
+            limb_t d = ai - bi - borrow;
+            borrow = (ai < bi || (ai == bi && borrow)) ? 1 : 0;
+            r[i] = d;
+        }
+        return borrow;
+    }
+
+    // r[0..rn) += a[0..an), an <= rn; prenos se propagira do kraja r
+    static void add_into(limb_t* r, std::size_t rn, const limb_t* a, std::size_t an) {
+        limb_t carry = add_n(r, r, a, an);
+        for (std::size_t i = an; carry && i < rn; ++i) carry = (++r[i] == 0) ? 1 : 0;
+    }
+
+    // r[0..rn) -= a[0..an), an <= rn; rezultat mora biti nenegativan
+    static void sub_from(limb_t* r, std::size_t rn, const limb_t* a, std::size_t an) {
+        limb_t borrow = sub_n(r, r, a, an);
+        for (std::size_t i = an; borrow && i < rn; ++i) borrow = (r[i]-- == 0) ? 1 : 0;
+    }
+
+    // d = |a - b|, a ima n limbova, b ima m <= n; vraća true ako je a < b
+    static bool abs_diff(limb_t* d, const limb_t* a, std::size_t n, const limb_t* b, std::size_t m) {
+        bool a_less = false;
+        bool a_top_zero = true;
+        for (std::size_t i = m; i < n; ++i) a_top_zero = a_top_zero && a[i] == 0;
+        if (a_top_zero) {
+            std::size_t i = m;
+            while (i > 0 && a[i - 1] == b[i - 1]) --i;
+            a_less = i > 0 && a[i - 1] < b[i - 1];
+        }
+        if (a_less) {
+            sub_n(d, b, a, m);
+            std::fill(d + m, d + n, 0);
+        } else {
+            std::copy(a + m, a + n, d + m);
+            limb_t borrow = sub_n(d, a, b, m);
+            for (std::size_t i = m; borrow && i < n; ++i) borrow = (d[i]-- == 0) ? 1 : 0;
+        }
+        return a_less;
+    }
+
+    // r[0..na+nb) = a * b, školski algoritam
+    static void mul_basecase(limb_t* r, const limb_t* a, std::size_t na, const limb_t* b, std::size_t nb) {
+        std::fill(r, r + na + nb, 0);
+        for (std::size_t i = 0; i < na; ++i) {
+            limb_t carry = 0;
+            const dlimb_t ai = a[i];
+            for (std::size_t j = 0; j < nb; ++j) {
+                dlimb_t t = ai * b[j] + r[i + j] + carry;
+                r[i + j] = static_cast<limb_t>(t);
+                carry = static_cast<limb_t>(t >> limb_bits);
+            }
+            r[i + nb] = carry;
+        }
+    }
+
+    // r[0..2n) = a^2; vandijagonalni proizvodi se računaju jednom i udvostručuju
+    static void sqr_basecase(limb_t* r, const limb_t* a, std::size_t n) {
+        std::fill(r, r + 2 * n, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            limb_t carry = 0;
+            const dlimb_t ai = a[i];
+            for (std::size_t j = i + 1; j < n; ++j) {
+                dlimb_t t = ai * a[j] + r[i + j] + carry;
+                r[i + j] = static_cast<limb_t>(t);
+                carry = static_cast<limb_t>(t >> limb_bits);
+            }
+            r[i + n] = carry;
+        }
+        // r *= 2
+        limb_t top = 0;
+        for (std::size_t i = 0; i < 2 * n; ++i) {
+            limb_t next = r[i] >> (limb_bits - 1);
+            r[i] = (r[i] << 1) | top;
+            top = next;
+        }
+        // + dijagonala
+        limb_t carry = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            dlimb_t sq = static_cast<dlimb_t>(a[i]) * a[i];
+            dlimb_t lo = static_cast<dlimb_t>(r[2 * i]) + static_cast<limb_t>(sq) + carry;
+            r[2 * i] = static_cast<limb_t>(lo);
+            dlimb_t hi = static_cast<dlimb_t>(r[2 * i + 1]) + static_cast<limb_t>(sq >> limb_bits)
+                         + static_cast<limb_t>(lo >> limb_bits);
+            r[2 * i + 1] = static_cast<limb_t>(hi);
+            carry = static_cast<limb_t>(hi >> limb_bits);
+        }
+    }
+
+    // Radni prostor za rekurziju veličine n: 6h + 1 po nivou, h = ceil(n/2)
+    static std::size_t karatsuba_scratch(std::size_t n) {
+        std::size_t total = 0;
+        while (n > 1) {
+            std::size_t h = (n + 1) / 2;
+            total += 6 * h + 1;
+            n = h;
+        }
+        return total + 1;
+    }
+
+    // Spaja z0 (r[0..2h)), z2 (r[2h..2n)) i |razliku| proizvoda t u r:
+    // z1 = z0 + z2 - t (sub_t) ili z0 + z2 + t, r += z1 * B^h
+    static void karatsuba_combine(limb_t* r, std::size_t n, std::size_t h,
+                                  const limb_t* t, bool sub_t, limb_t* mid) {
+        const std::size_t l = n - h;
+        const std::size_t midn = 2 * h + 1;
+        std::copy(r, r + 2 * h, mid);
+        mid[2 * h] = 0;
+        add_into(mid, midn, r + 2 * h, 2 * l);
+        if (sub_t) sub_from(mid, midn, t, 2 * h);
+        else add_into(mid, midn, t, 2 * h);
+
+        // z1 < B^(2n-h) jer ceo proizvod staje u 2n limbova
+        std::size_t mn = midn;
+        while (mn > 0 && mid[mn - 1] == 0) --mn;
+        add_into(r + h, 2 * n - h, mid, mn);
+    }
+
+    // r[0..2n) = a * b, oba operanda imaju n limbova
+    static void karatsuba_mul(limb_t* r, const limb_t* a, const limb_t* b, std::size_t n,
+                              std::size_t threshold, limb_t* ws) {
+        if (n < threshold) {
+            mul_basecase(r, a, n, b, n);
+            return;
+        }
+        const std::size_t h = (n + 1) / 2;
+        const std::size_t l = n - h;
+        limb_t* da = ws;
+        limb_t* db = da + h;
+        limb_t* t = db + h;
+        limb_t* mid = t + 2 * h;
+        limb_t* next = mid + 2 * h + 1;
+
+        // (a0 - a1)(b0 - b1) = z0 + z2 - z1
+        bool neg_a = abs_diff(da, a, h, a + h, l);
+        bool neg_b = abs_diff(db, b, h, b + h, l);
+        karatsuba_mul(t, da, db, h, threshold, next);
+
+        karatsuba_mul(r, a, b, h, threshold, next);                 // z0
+        karatsuba_mul(r + 2 * h, a + h, b + h, l, threshold, next); // z2
+        karatsuba_combine(r, n, h, t, neg_a == neg_b, mid);
+    }
+
+    // r[0..2n) = a^2
+    static void karatsuba_sqr(limb_t* r, const limb_t* a, std::size_t n,
+                              std::size_t threshold, limb_t* ws) {
+        if (n < threshold) {
+            sqr_basecase(r, a, n);
+            return;
+        }
+        const std::size_t h = (n + 1) / 2;
+        const std::size_t l = n - h;
+        limb_t* da = ws;
+        limb_t* t = da + 2 * h; // isti raspored kao kod množenja
+        limb_t* mid = t + 2 * h;
+        limb_t* next = mid + 2 * h + 1;
+
+        abs_diff(da, a, h, a + h, l);
+        karatsuba_sqr(t, da, h, threshold, next);
+
+        karatsuba_sqr(r, a, h, threshold, next);
+        karatsuba_sqr(r + 2 * h, a + h, l, threshold, next);
+        karatsuba_combine(r, n, h, t, true, mid);
+    }
+
+    static BigInt from_limbs(const limb_t* p, std::size_t n) {
+        // Gornji limbovi proizvoda dopunjenih operanada su nule; fiksni backend nema mesta za njih
+        while (n > 0 && p[n - 1] == 0) --n;
+        if (bigint_max_bits != 0 && n * limb_bits > bigint_max_bits)
+            throw std::overflow_error("mul: product exceeds BigInt capacity");
+        BigInt r;
+        r.backend().resize(static_cast<unsigned>(n), static_cast<unsigned>(n));
+        std::memcpy(r.backend().limbs(), p, n * sizeof(limb_t));
+        r.backend().normalize();
+        return r;
+    }
+
+    BigInt mul(const BigInt& a, const BigInt& b) {
+        if (a < 0 || b < 0) throw std::invalid_argument("mul: negative not supported");
+        const std::size_t na = limb_count(a), nb = limb_count(b);
+        const std::size_t threshold = g_karatsuba_mul.load(std::memory_order_relaxed);
+        if (std::min(na, nb) < threshold) return a * b;
+
+        // Operandi različite dužine se dopunjuju nulama; u modexp su dužine skoro jednake
+        const std::size_t n = std::max(na, nb);
+        std::vector<limb_t> buf(4 * n + karatsuba_scratch(n), 0);
+        limb_t* ap = buf.data();
+        limb_t* bp = ap + n;
+        limb_t* r = bp + n;
+        std::memcpy(ap, a.backend().limbs(), na * sizeof(limb_t));
+        std::memcpy(bp, b.backend().limbs(), nb * sizeof(limb_t));
+        karatsuba_mul(r, ap, bp, n, threshold, r + 2 * n);
+        return from_limbs(r, 2 * n);
+    }
+
+    BigInt sqr(const BigInt& a) {
+        if (a < 0) throw std::invalid_argument("sqr: negative not supported");
+        const std::size_t n = limb_count(a);
+        const std::size_t threshold = g_karatsuba_sqr.load(std::memory_order_relaxed);
+        if (n < threshold) return a * a;
+
+        std::vector<limb_t> buf(2 * n + karatsuba_scratch(n));
+        karatsuba_sqr(buf.data(), a.backend().limbs(), n, threshold, buf.data() + 2 * n);
+        return from_limbs(buf.data(), 2 * n);
+    }
+
+#else
+
+    // GMP već bira Karatsuba/Toom-Cook/FFT po veličini; pragovi se ovde ne koriste
+    BigInt mul(const BigInt& a, const BigInt& b) {
+        if (a < 0 || b < 0) throw std::invalid_argument("mul: negative not supported");
+        return a * b;
+    }
+
+    BigInt sqr(const BigInt& a) {
+        if (a < 0) throw std::invalid_argument("sqr: negative not supported");
+        return a * a;
+    }
+
+#endif
+
+    BarrettReducer::BarrettReducer(const BigInt& m) : m_(m) {
+        if (m <= 0) throw std::invalid_argument("BarrettReducer: mod must be > 0");
+        k_ = static_cast<unsigned>(limb_count(m));
+        BigInt b2k = 1;
+        b2k <<= 2 * k_ * limb_bits;
+        mu_ = b2k / m;
+    }
+
+    BigInt BarrettReducer::reduce(const BigInt& x) const {
+        // HAC 14.42: q = floor(floor(x / B^(k-1)) * mu / B^(k+1)), r = x - q*m, r < 3m
+        BigInt q = x >> ((k_ - 1) * limb_bits);
+        q = mul(q, mu_);
+        q >>= (k_ + 1) * limb_bits;
+        BigInt r = x - mul(q, m_);
+        while (r >= m_) r -= m_;
+        return r;
+    }
+
+} // namespace CryptoLib
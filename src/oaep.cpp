@@ -6,41 +6,33 @@
 
 namespace CryptoLib {
 
-    static std::vector<std::uint8_t> i2osp(std::uint32_t x, std::size_t len) {
-        std::vector<std::uint8_t> out(len, 0);
-        for (std::size_t i = 0; i < len; ++i) {
-            out[len - 1 - i] = static_cast<std::uint8_t>((x >> (8 * i)) & 0xFF);
-        }
-        return out;
-    }
-
-    std::vector<std::uint8_t> mgf1_sha256(const std::vector<std::uint8_t>& seed, std::size_t len) {
+    template <class Hash>
+    std::vector<std::uint8_t> mgf1(const std::vector<std::uint8_t>& seed, std::size_t len) {
+        constexpr std::size_t hLen = Hash::digest_size;
         std::vector<std::uint8_t> out;
         out.reserve(len);
-        std::uint32_t counter = 0;
-        const std::size_t hLen = 32;
 
-        while (out.size() < len) {
-            auto C = i2osp(counter, 4);
-            std::vector<std::uint8_t> input;
-            input.reserve(seed.size() + 4);
-            input.insert(input.end(), seed.begin(), seed.end());
-            input.insert(input.end(), C.begin(), C.end());
+        // input = seed || C; brojač C (4 bajta, big-endian) se menja na mestu
+        std::vector<std::uint8_t> input(seed);
+        input.resize(seed.size() + 4);
+        std::uint8_t* C = input.data() + seed.size();
+        for (std::uint32_t counter = 0; out.size() < len; ++counter) {
+            for (std::size_t i = 0; i < 4; ++i) C[3 - i] = static_cast<std::uint8_t>(counter >> (8 * i));
 
-            auto h = sha256(input);
+            auto h = Hash::hash(input);
             std::size_t take = std::min(hLen, len - out.size());
             out.insert(out.end(), h.begin(), h.begin() + take);
-            counter++;
         }
         return out;
     }
 
+    template <class Hash>
     std::vector<std::uint8_t> oaep_encode(const std::vector<std::uint8_t>& msg, std::size_t k) {
-        const std::size_t hLen = 32; // SHA-256
+        constexpr std::size_t hLen = Hash::digest_size;
         if (k < 2 * hLen + 2) throw std::invalid_argument("oaep_encode: modulus too small");
         if (msg.size() > k - 2 * hLen - 2) throw std::invalid_argument("oaep_encode: message too long");
 
-        std::vector<std::uint8_t> lHash = sha256({});
+        std::vector<std::uint8_t> lHash = Hash::hash({});
         std::size_t psLen = k - msg.size() - 2 * hLen - 2;
 
         // DB = lHash || PS (zero bytes) || 0x01 || M
@@ -56,13 +48,13 @@ namespace CryptoLib {
         csprng_bytes(seed);
 
         // dbMask = MGF1(seed, k - hLen - 1)
-        auto dbMask = mgf1_sha256(seed, k - hLen - 1);
+        auto dbMask = mgf1<Hash>(seed, k - hLen - 1);
         // maskedDB = DB XOR dbMask
         std::vector<std::uint8_t> maskedDB(DB.size());
         for (std::size_t i = 0; i < DB.size(); ++i) maskedDB[i] = DB[i] ^ dbMask[i];
 
         // seedMask = MGF1(maskedDB, hLen)
-        auto seedMask = mgf1_sha256(maskedDB, hLen);
+        auto seedMask = mgf1<Hash>(maskedDB, hLen);
         // maskedSeed = seed XOR seedMask
         std::vector<std::uint8_t> maskedSeed(hLen);
         for (std::size_t i = 0; i < hLen; ++i) maskedSeed[i] = seed[i] ^ seedMask[i];
@@ -78,8 +70,9 @@ namespace CryptoLib {
         return EM;
     }
 
+    template <class Hash>
     std::vector<std::uint8_t> oaep_decode(const std::vector<std::uint8_t>& em, std::size_t k) {
-        const std::size_t hLen = 32; // SHA-256
+        constexpr std::size_t hLen = Hash::digest_size;
         if (k < 2 * hLen + 2) throw std::invalid_argument("oaep_decode: modulus too small");
         if (em.size() != k) throw std::invalid_argument("oaep_decode: input size mismatch");
 
@@ -90,19 +83,19 @@ namespace CryptoLib {
         std::vector<std::uint8_t> maskedDB(em.begin() + 1 + hLen, em.end());
 
         // seedMask = MGF1(maskedDB, hLen)
-        auto seedMask = mgf1_sha256(maskedDB, hLen);
+        auto seedMask = mgf1<Hash>(maskedDB, hLen);
         // seed = maskedSeed XOR seedMask
         std::vector<std::uint8_t> seed(hLen);
         for (std::size_t i = 0; i < hLen; ++i) seed[i] = maskedSeed[i] ^ seedMask[i];
 
         // dbMask = MGF1(seed, k - hLen - 1)
-        auto dbMask = mgf1_sha256(seed, k - hLen - 1);
+        auto dbMask = mgf1<Hash>(seed, k - hLen - 1);
         // DB = maskedDB XOR dbMask
         std::vector<std::uint8_t> DB(maskedDB.size());
         for (std::size_t i = 0; i < maskedDB.size(); ++i) DB[i] = maskedDB[i] ^ dbMask[i];
 
         // DB = lHash || PS || 0x01 || M
-        auto lHash = sha256({});
+        auto lHash = Hash::hash({});
         // verifikuj lHash
         if (!std::equal(DB.begin(), DB.begin() + hLen, lHash.begin(), lHash.end()))
             throw std::runtime_error("oaep_decode: lHash mismatch");
@@ -118,4 +111,26 @@ namespace CryptoLib {
         return M;
     }
 
+    template std::vector<std::uint8_t> mgf1<Sha256>(const std::vector<std::uint8_t>&, std::size_t);
+    template std::vector<std::uint8_t> mgf1<Sha384>(const std::vector<std::uint8_t>&, std::size_t);
+    template std::vector<std::uint8_t> mgf1<Sha512>(const std::vector<std::uint8_t>&, std::size_t);
+    template std::vector<std::uint8_t> oaep_encode<Sha256>(const std::vector<std::uint8_t>&, std::size_t);
+    template std::vector<std::uint8_t> oaep_encode<Sha384>(const std::vector<std::uint8_t>&, std::size_t);
+    template std::vector<std::uint8_t> oaep_encode<Sha512>(const std::vector<std::uint8_t>&, std::size_t);
+    template std::vector<std::uint8_t> oaep_decode<Sha256>(const std::vector<std::uint8_t>&, std::size_t);
+    template std::vector<std::uint8_t> oaep_decode<Sha384>(const std::vector<std::uint8_t>&, std::size_t);
+    template std::vector<std::uint8_t> oaep_decode<Sha512>(const std::vector<std::uint8_t>&, std::size_t);
+
+    std::vector<std::uint8_t> mgf1_sha256(const std::vector<std::uint8_t>& seed, std::size_t len) {
+        return mgf1<Sha256>(seed, len);
+    }
+
+    std::vector<std::uint8_t> oaep_encode(const std::vector<std::uint8_t>& msg, std::size_t k) {
+        return oaep_encode<Sha256>(msg, k);
+    }
+
+    std::vector<std::uint8_t> oaep_decode(const std::vector<std::uint8_t>& em, std::size_t k) {
+        return oaep_decode<Sha256>(em, k);
+    }
+
 } // namespace CryptoLib
\ No newline at end of file
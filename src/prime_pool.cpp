@@ -0,0 +1,251 @@
+#include "prime_pool.hpp"
+#include "prime_utils.hpp"
+#include "random_utils.hpp"
+#include "aead.hpp"
+#include "utils.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <cstdio>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+namespace CryptoLib {
+
+    static const std::uint8_t persist_magic[5] = { 'C', 'L', 'P', 'P', 0x01 };
+
+    static void set_low_priority() {
+#if defined(_WIN32)
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+#elif defined(__linux__)
+        setpriority(PRIO_PROCESS, 0, 19); // na Linux-u deluje samo na tekuću nit
+#endif
+    }
+
+    static void put_u32(std::vector<std::uint8_t>& out, std::uint32_t v) {
+        for (int i = 3; i >= 0; --i) out.push_back(static_cast<std::uint8_t>(v >> (8 * i)));
+    }
+
+    static std::uint32_t get_u32(const std::vector<std::uint8_t>& in, std::size_t& pos) {
+        if (pos + 4 > in.size()) throw std::runtime_error("PrimePool: persisted pool truncated");
+        std::uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) v = (v << 8) | in[pos++];
+        return v;
+    }
+
+    PrimePool::PrimePool(const PrimePoolConfig& config) : config_(config) {
+        if (config_.prime_bits.empty()) throw std::invalid_argument("PrimePool: no prime sizes configured");
+        if (config_.high_watermark == 0 || config_.low_watermark > config_.high_watermark)
+            throw std::invalid_argument("PrimePool: invalid watermarks");
+        if (!config_.persist_path.empty() && config_.persist_key.size() != Aes256Gcm::key_size)
+            throw std::invalid_argument("PrimePool: persist_key must be 32 bytes");
+        for (int bits : config_.prime_bits) {
+            if (bits < 16) throw std::invalid_argument("PrimePool: prime size too small");
+            buckets_[bits];
+        }
+
+        load();
+        for (unsigned i = 0; i < config_.threads; ++i) threads_.emplace_back(&PrimePool::worker, this);
+    }
+
+    PrimePool::~PrimePool() {
+        try {
+            stop();
+        } catch (...) {
+            // destruktor ne sme da baci; neuspelo čuvanje samo znači prazan pool sledeći put
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& kv : buckets_) {
+            for (auto& p : kv.second.primes) secure_wipe(p);
+            kv.second.primes.clear();
+        }
+        secure_wipe(config_.persist_key);
+    }
+
+    int PrimePool::next_job() {
+        // Histereza: dopuna kreće ispod low_watermark (računaju se i brojevi u izradi) i traje
+        // dok na stanju ne bude high_watermark. Kraj se ne meri sa in_flight: take() koji stigne
+        // dok se poslednji posao još radi inače bi ostavio pool na high - 1, iznad low, bez dopune.
+        for (auto& kv : buckets_) {
+            Bucket& b = kv.second;
+            const std::size_t level = b.primes.size() + b.in_flight;
+            if (level < config_.low_watermark) b.refilling = true;
+            if (b.primes.size() >= config_.high_watermark) b.refilling = false;
+            if (b.refilling && level < config_.high_watermark) return kv.first;
+        }
+        return 0;
+    }
+
+    void PrimePool::worker() {
+        set_low_priority();
+        while (true) {
+            int bits = 0;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&] { return stopping_.load() || (bits = next_job()) != 0; });
+                if (stopping_) return;
+                ++buckets_[bits].in_flight;
+            }
+
+            // Isto kao generate_prime, ali se prekida između kandidata kada se pool zaustavlja
+            BigInt cand;
+            bool found = false;
+            while (!stopping_) {
+                cand = random_bigint_bits(bits);
+                if (is_probable_prime(cand, 32)) { found = true; break; }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            Bucket& b = buckets_[bits];
+            --b.in_flight;
+            if (found) {
+                b.primes.push_back(std::move(cand));
+                ++b.stats.generated;
+            }
+            secure_wipe(cand);
+            cv_.notify_all();
+        }
+    }
+
+    bool PrimePool::try_take(int bits, BigInt& out) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = buckets_.find(bits);
+        if (it == buckets_.end()) return false;
+        Bucket& b = it->second;
+        if (b.primes.empty()) {
+            ++b.stats.misses;
+            cv_.notify_all();
+            return false;
+        }
+
+        out.swap(b.primes.front());
+        secure_wipe(b.primes.front());
+        b.primes.pop_front();
+        ++b.stats.hits;
+        // Tokom dopune svaki take() otvara mesto za još jedan posao
+        if (b.refilling || b.primes.size() + b.in_flight < config_.low_watermark) cv_.notify_all();
+        return true;
+    }
+
+    BigInt PrimePool::take(int bits) {
+        BigInt p;
+        if (try_take(bits, p)) return p;
+        return generate_prime(bits);
+    }
+
+    PrimePoolStats PrimePool::stats(int bits) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = buckets_.find(bits);
+        if (it == buckets_.end()) return PrimePoolStats{};
+        PrimePoolStats s = it->second.stats;
+        s.available = it->second.primes.size();
+        return s;
+    }
+
+    void PrimePool::stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopped_) return;
+            stopped_ = true;
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto& t : threads_) t.join();
+        threads_.clear();
+        save();
+    }
+
+    void PrimePool::save() {
+        if (config_.persist_path.empty()) return;
+
+        // Format: "CLPP" 0x01 || nonce(12) || AES-GCM(bits u32 || len u32 || bajtovi ...)
+        std::vector<std::uint8_t> plain;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& kv : buckets_) {
+                for (const auto& p : kv.second.primes) {
+                    auto bytes = bigint_to_bytes(p);
+                    put_u32(plain, static_cast<std::uint32_t>(kv.first));
+                    put_u32(plain, static_cast<std::uint32_t>(bytes.size()));
+                    plain.insert(plain.end(), bytes.begin(), bytes.end());
+                    secure_wipe(bytes);
+                }
+            }
+        }
+
+        const std::vector<std::uint8_t> header(std::begin(persist_magic), std::end(persist_magic));
+        std::vector<std::uint8_t> nonce(Aes256Gcm::nonce_size);
+        csprng_bytes(nonce);
+        const Aes256Gcm aead(config_.persist_key);
+        auto sealed = aead.seal(nonce, header, plain);
+        secure_wipe(plain);
+
+        std::ofstream ofs(config_.persist_path, std::ios::binary | std::ios::trunc);
+        if (!ofs) throw std::runtime_error("PrimePool: cannot write " + config_.persist_path);
+        ofs.write(reinterpret_cast<const char*>(header.data()), header.size());
+        ofs.write(reinterpret_cast<const char*>(nonce.data()), nonce.size());
+        ofs.write(reinterpret_cast<const char*>(sealed.data()), sealed.size());
+    }
+
+    void PrimePool::load() {
+        if (config_.persist_path.empty()) return;
+        std::vector<std::uint8_t> data;
+        {
+            std::ifstream ifs(config_.persist_path, std::ios::binary);
+            if (!ifs) return; // nema sačuvanog stanja
+            data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        }
+        // Prost broj sme biti iskorišćen samo jednom, čak i ako proces padne pre save()
+        std::remove(config_.persist_path.c_str());
+
+        const std::size_t hdr = sizeof(persist_magic);
+        if (data.size() < hdr + Aes256Gcm::nonce_size + Aes256Gcm::tag_size
+            || !std::equal(std::begin(persist_magic), std::end(persist_magic), data.begin()))
+            throw std::runtime_error("PrimePool: persisted pool has invalid header");
+
+        const std::vector<std::uint8_t> header(data.begin(), data.begin() + hdr);
+        const std::vector<std::uint8_t> nonce(data.begin() + hdr, data.begin() + hdr + Aes256Gcm::nonce_size);
+        const std::vector<std::uint8_t> sealed(data.begin() + hdr + Aes256Gcm::nonce_size, data.end());
+        const Aes256Gcm aead(config_.persist_key);
+        auto plain = aead.open(nonce, header, sealed);
+
+        std::size_t pos = 0;
+        while (pos < plain.size()) {
+            const int bits = static_cast<int>(get_u32(plain, pos));
+            const std::uint32_t len = get_u32(plain, pos);
+            if (pos + len > plain.size()) throw std::runtime_error("PrimePool: persisted pool truncated");
+            std::vector<std::uint8_t> bytes(plain.begin() + pos, plain.begin() + pos + len);
+            pos += len;
+            BigInt p = bytes_to_bigint(bytes);
+            secure_wipe(bytes);
+
+            auto it = buckets_.find(bits);
+            if (it != buckets_.end() && it->second.primes.size() < config_.high_watermark
+                && static_cast<int>(msb(p)) + 1 == bits) {
+                it->second.primes.push_back(std::move(p));
+                ++it->second.stats.loaded;
+            }
+            secure_wipe(p);
+        }
+        secure_wipe(plain);
+    }
+
+    static std::mutex g_pool_mutex;
+    static std::shared_ptr<PrimePool> g_pool;
+
+    void set_prime_pool(std::shared_ptr<PrimePool> pool) {
+        std::lock_guard<std::mutex> lock(g_pool_mutex);
+        g_pool = std::move(pool);
+    }
+
+    std::shared_ptr<PrimePool> get_prime_pool() {
+        std::lock_guard<std::mutex> lock(g_pool_mutex);
+        return g_pool;
+    }
+
+} // namespace CryptoLib
@@ -1,22 +1,18 @@
 #include "prime_utils.hpp"
 #include "random_utils.hpp"
 #include "bigint_utils.hpp"
+#include "montgomery.hpp"
 #include <vector>
 #include <stdexcept>
 #include <algorithm>
 
 namespace CryptoLib {
 
-    static BigInt bytes_to_bigint_be(const std::vector<std::uint8_t>& bytes) {
-        BigInt x = 0;
-        for (auto b : bytes) { x <<= 8; x += b; }
-        return x;
-    }
-
-    BigInt random_bigint_bits(int bits) {
+    // buf = nasumičnih bits bitova, big-endian, sa postavljenim najvišim i najnižim bitom
+    static void random_bits_bytes(int bits, std::vector<std::uint8_t>& buf) {
         if (bits <= 0) throw std::invalid_argument("random_bigint_bits: bits must be > 0");
         const int bytes = (bits + 7) / 8;
-        std::vector<std::uint8_t> buf(bytes);
+        buf.resize(bytes);
         csprng_bytes(buf);
 
         // Maskiraj višak bitova
@@ -27,44 +23,90 @@ namespace CryptoLib {
         }
         buf[0] |= 0x80;                   // MSB set -> tačna bit-dužina
         buf[bytes - 1] |= 0x01;           // odd
+    }
 
-        return bytes_to_bigint_be(buf);
+    template <class Int>
+    static void random_bits_into(Int& out, int bits, std::vector<std::uint8_t>& buf) {
+        random_bits_bytes(bits, buf);
+        boost::multiprecision::import_bits(out, buf.begin(), buf.end(), 8, true);
     }
 
-    static bool miller_rabin_witness(const BigInt& a, const BigInt& n, const BigInt& d, int s) {
-        BigInt x = modexp(a, d, n);
-        if (x == 1 || x == n - 1) return false;
+    BigInt random_bigint_bits(int bits) {
+        std::vector<std::uint8_t> buf;
+#if defined(CRYPTOLIB_BIGINT_GMP)
+        // import_bits postoji samo za cpp_int; uvoz ide preko bytes_to_bigint
+        random_bits_bytes(bits, buf);
+        return bytes_to_bigint(buf);
+#else
+        BigInt x;
+        random_bits_into(x, bits, buf);
+        return x;
+#endif
+    }
+
+    // x = a^d mod n; true ako a svedoči da je n složen
+    static bool miller_rabin_composite(ArenaBigInt& x, const ArenaBigInt& n, const ArenaBigInt& nm1, int s) {
+        if (x == 1 || x == nm1) return false;
         for (int i = 1; i < s; ++i) {
-            x = (x * x) % n;
-            if (x == n - 1) return false;
+            x *= x;
+            x %= n;
+            if (x == nm1) return false;
         }
-        return true; // composite
+        return true;
     }
 
     bool is_probable_prime(const BigInt& n, int rounds) {
         if (n < 2) return false;
+
+        // Sve privremene vrednosti (i deljenje malim prostim brojevima) su u areni:
+        // posle zagrevanja nema poziva sistemskog alokatora
+        ArenaScope scope;
+        const ArenaBigInt na(n);
         static const int smalls[] = {2,3,5,7,11,13,17,19,23,29,31,37};
         for (int p : smalls) {
-            if (n == p) return true;
-            if (n % p == 0) return n == p;
+            if (na == p) return true;
+            if (boost::multiprecision::integer_modulus(na, p) == 0) return false;
         }
 
-        BigInt d = n - 1;
+        const ArenaBigInt nm1 = na - 1;
+        const ArenaBigInt nm2 = na - 2;
+        const ArenaBigInt nm3 = na - 3;
+        ArenaBigInt d = nm1;
         int s = 0;
         while ((d & 1) == 0) { d >>= 1; ++s; }
 
-        auto nbytes = bigint_to_bytes(n).size();
-        int bits = static_cast<int>(nbytes * 8);
+        const int bits = static_cast<int>((msb(n) / 8 + 1) * 8);
 
-        for (int r = 0; r < rounds; ++r) {
-            BigInt a = random_bigint_bits(bits);
-            if (a >= n - 2) {
-                a %= (n - 3);
+        // Baze nisu tajne; bafer se čuva po niti da se ne alocira za svaku rundu
+        static thread_local std::vector<std::uint8_t> buf;
+        auto random_base = [&](ArenaBigInt& a) {
+            random_bits_into(a, bits, buf);
+            if (a >= nm2) {
+                a %= nm3;
                 a += 2;
             } else {
                 a += 2;
             }
-            if (miller_rabin_witness(a, n, d, s)) return false;
+        };
+
+        // Prva runda sama: većina složenih kandidata pada već na njoj. Preostale (kandidat je
+        // tada skoro sigurno prost) idu po mont_batch_lanes() svedoka kroz multi-buffer kernel.
+        ArenaBigInt a, x;
+        if (rounds > 0) {
+            random_base(a);
+            x = modexp_arena(a, d, na);
+            if (miller_rabin_composite(x, na, nm1, s)) return false;
+        }
+        const std::size_t lanes = get_mont_kernel() == MontKernel::None ? 1 : mont_batch_lanes();
+        std::vector<ArenaBigInt, ArenaAllocator<ArenaBigInt>> as(lanes), xs(lanes);
+        for (int r = 1; r < rounds;) {
+            const std::size_t cnt = std::min<std::size_t>(lanes, static_cast<std::size_t>(rounds - r));
+            for (std::size_t i = 0; i < cnt; ++i) random_base(as[i]);
+            if (cnt == 1) xs[0] = modexp_arena(as[0], d, na);
+            else mont_modexp_batch_arena(as.data(), d, na, xs.data(), cnt);
+            for (std::size_t i = 0; i < cnt; ++i)
+                if (miller_rabin_composite(xs[i], na, nm1, s)) return false;
+            r += static_cast<int>(cnt);
         }
         return true;
     }
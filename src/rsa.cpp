@@ -3,17 +3,250 @@
 #include "prime_utils.hpp"
 #include "oaep.hpp"
 #include "hash_utils.hpp"
+#include "utils.hpp"
+#include "prime_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <stdexcept>
 
 namespace CryptoLib {
 
+    // Prost broj iz instaliranog pool-a ako ima stanja, inače generisan na zahtev
+    static BigInt next_prime(int bits) {
+        auto pool = get_prime_pool();
+        return pool ? pool->take(bits) : generate_prime(bits);
+    }
+
+    // ---- Blinding ----
+    //
+    // Par (vi, vf) = (r^e, r^-1) mod n: (c * vi)^d * vf = c * r * r^-1 = c^d. Posle upotrebe
+    // oba člana se kvadriraju (vi^d * vf = 1 i dalje važi), što košta dva množenja umesto
+    // inverza i stepenovanja po operaciji. Na svakih blinding_refresh upotreba par se pravi
+    // od novog r, da niz parova ne bi bio predvidiv predugo. Keš je thread_local (nema
+    // zaključavanja), a PrivateKey ostaje običan struct koji se slobodno kopira. Slot se
+    // prepoznaje po SHA-256 otisku ključa, pa keš ne drži kopiju d.
+
+    static constexpr unsigned blinding_refresh = 32;
+    static constexpr std::size_t blinding_cache_size = 4; // ključeva po niti
+
+    static std::atomic<bool> g_blinding{ true };
+    // clear_blinding_cache() ga uvećava; keš niti sa starijom epohom se briše pri sledećoj upotrebi
+    static std::atomic<std::uint64_t> g_blinding_epoch{ 0 };
+
+    using KeyId = std::array<std::uint8_t, Sha256::digest_size>;
+
+    // SHA-256(n || e || d), svaki sa dužinom ispred; jednom po privatnoj operaciji ili seriji
+    static KeyId key_id(const PrivateKey& priv) {
+        std::vector<std::uint8_t> buf;
+        for (const BigInt* x : { &priv.n, &priv.e, &priv.d }) {
+            std::vector<std::uint8_t> bytes = bigint_to_bytes(*x);
+            const std::uint32_t len = static_cast<std::uint32_t>(bytes.size());
+            for (int i = 3; i >= 0; --i) buf.push_back(static_cast<std::uint8_t>(len >> (8 * i)));
+            buf.insert(buf.end(), bytes.begin(), bytes.end());
+            secure_wipe(bytes);
+        }
+        const std::vector<std::uint8_t> digest = sha256(buf);
+        secure_wipe(buf);
+        KeyId id;
+        std::copy(digest.begin(), digest.end(), id.begin());
+        return id;
+    }
+
+    struct BlindingPair {
+        KeyId key{};       // otisak ključa kome par pripada
+        bool used = false; // false = prazan slot
+        BigInt vi, vf;
+        unsigned uses = 0;
+        std::uint64_t stamp = 0; // za izbacivanje najdavnije korišćenog
+
+        void clear() {
+            key.fill(0);
+            used = false;
+            secure_wipe(vi);
+            secure_wipe(vf);
+            uses = 0;
+            stamp = 0;
+        }
+
+        ~BlindingPair() { clear(); }
+    };
+
+    static void regenerate(BlindingPair& bp, const PrivateKey& priv) {
+        const BigInt& n = priv.n;
+        const unsigned bits = msb(n); // r ima bit manje od n, pa je r < n
+        BigInt r;
+        while (true) {
+            r = random_bigint_bits(static_cast<int>(bits));
+            try {
+                if (priv.e != 0) {
+                    bp.vf = modinv(r, n);
+                    bp.vi = modexp(r, priv.e, n);
+                } else {
+                    // Bez javnog eksponenta: vi = r, vf = (r^-1)^d; jedno puno stepenovanje
+                    // po obnavljanju, ali nad slučajnom vrednošću
+                    bp.vi = r;
+                    bp.vf = modexp(modinv(r, n), priv.d, n);
+                }
+                break;
+            } catch (const std::runtime_error&) {
+                // gcd(r, n) != 1; praktično nemoguće za ispravan ključ
+            }
+        }
+        secure_wipe(r);
+        bp.uses = 0;
+    }
+
+    struct BlindingCache {
+        std::array<BlindingPair, blinding_cache_size> slots;
+        std::uint64_t clock = 0;
+        std::uint64_t epoch = 0;
+
+        void clear() {
+            for (auto& bp : slots) bp.clear();
+        }
+    };
+
+    static BlindingCache& thread_blinding_cache() {
+        static thread_local BlindingCache cache;
+        return cache;
+    }
+
+    static BlindingPair& blinding_for(const PrivateKey& priv, const KeyId& id) {
+        BlindingCache& cache = thread_blinding_cache();
+        const std::uint64_t epoch = g_blinding_epoch.load(std::memory_order_acquire);
+        if (cache.epoch != epoch) {
+            cache.clear();
+            cache.epoch = epoch;
+        }
+
+        BlindingPair* slot = &cache.slots[0];
+        for (auto& bp : cache.slots) {
+            if (bp.used && bp.key == id) {
+                if (bp.uses >= blinding_refresh) regenerate(bp, priv);
+                bp.stamp = ++cache.clock;
+                return bp;
+            }
+            if (bp.stamp < slot->stamp) slot = &bp;
+        }
+
+        slot->clear();
+        regenerate(*slot, priv);
+        // e koji ne odgovara d dao bi pogrešne rezultate bez greške; vi^d * vf = r^(ed) * r^-1
+        // je 1 samo za ispravan par. Proverava se jednom, kada ključ uđe u keš niti.
+        if (priv.e != 0 && modexp(slot->vi, priv.d, priv.n) * slot->vf % priv.n != 1) {
+            slot->clear();
+            throw std::invalid_argument("RSA: private exponent does not match public exponent");
+        }
+        slot->key = id;
+        slot->used = true;
+        slot->stamp = ++cache.clock;
+        return *slot;
+    }
+
+    // Posle upotrebe par se kvadrira
+    static void advance(BlindingPair& bp, const BigInt& n) {
+        bp.vi = bp.vi * bp.vi % n;
+        bp.vf = bp.vf * bp.vf % n;
+        ++bp.uses;
+    }
+
+    // x^d mod n, sa blinding-om kada je uključen
+    static BigInt private_op(const BigInt& x, const PrivateKey& priv) {
+        const BigInt& n = priv.n;
+        if (!g_blinding.load(std::memory_order_relaxed)) return modexp(x, priv.d, n);
+
+        BlindingPair& bp = blinding_for(priv, key_id(priv));
+        BigInt blinded = x * bp.vi % n;
+        BigInt y = modexp(blinded, priv.d, n);
+        y = y * bp.vf % n;
+        secure_wipe(blinded);
+        advance(bp, n);
+        return y;
+    }
+
+    // Svež par za svaki element serije: r_i^-1 za sve odjednom (modinv_batch, jedan inverz)
+    // i r_i^e kroz modexp_batch. false ako neki r_i nije uzajamno prost sa n.
+    static bool fresh_blinding(std::vector<BigInt>& xs, std::vector<BigInt>& vf, const PrivateKey& priv) {
+        const BigInt& n = priv.n;
+        std::vector<BigInt> rs;
+        rs.reserve(xs.size());
+        for (std::size_t i = 0; i < xs.size(); ++i) rs.push_back(random_bigint_bits(static_cast<int>(msb(n))));
+        try {
+            vf = modinv_batch(rs, n);
+        } catch (const std::runtime_error&) {
+            for (auto& r : rs) secure_wipe(r);
+            return false;
+        }
+        std::vector<BigInt> vi = modexp_batch(rs, { priv.e }, { n });
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            xs[i] = xs[i] * vi[i] % n;
+            secure_wipe(vi[i]);
+            secure_wipe(rs[i]);
+        }
+        return true;
+    }
+
+    // Isto za seriju jednim ključem; stepenovanja idu zajedno kroz multi-buffer modexp_batch.
+    // Uz poznat e svaki element dobija nezavisan par; inače se parovi iz keša troše redom,
+    // kao kod uzastopnih private_op poziva.
+    static std::vector<BigInt> private_op_batch(std::vector<BigInt> xs, const PrivateKey& priv) {
+        const BigInt& n = priv.n;
+        std::vector<BigInt> d{ priv.d };
+        const std::vector<BigInt> mod{ n };
+        std::vector<BigInt> vf;
+        const bool blinding = g_blinding.load(std::memory_order_relaxed);
+        // Slot u kešu i kod svežih parova: provera e/d se radi jednom po ključu i niti
+        const KeyId id = blinding ? key_id(priv) : KeyId{};
+        if (blinding) blinding_for(priv, id);
+        if (blinding && (priv.e == 0 || !fresh_blinding(xs, vf, priv))) {
+            vf.reserve(xs.size());
+            for (auto& x : xs) {
+                BlindingPair& bp = blinding_for(priv, id);
+                x = x * bp.vi % n;
+                vf.push_back(bp.vf);
+                advance(bp, n);
+            }
+        }
+
+        std::vector<BigInt> ys = modexp_batch(xs, d, mod);
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            if (blinding) {
+                ys[i] = ys[i] * vf[i] % n;
+                secure_wipe(vf[i]);
+            }
+            secure_wipe(xs[i]);
+        }
+        secure_wipe(d[0]);
+        return ys;
+    }
+
+    void RSA::set_blinding(bool enabled) {
+        g_blinding.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool RSA::blinding_enabled() {
+        return g_blinding.load(std::memory_order_relaxed);
+    }
+
+    void RSA::clear_blinding_cache() {
+        g_blinding_epoch.fetch_add(1, std::memory_order_release);
+        BlindingCache& cache = thread_blinding_cache();
+        cache.clear();
+        cache.epoch = g_blinding_epoch.load(std::memory_order_acquire);
+    }
+
     RSAKeyPair RSA::generate_keys(int bits) {
         if (bits < 512) throw std::invalid_argument("RSA key size too small; use >= 1024.");
+        if (bigint_max_bits != 0 && 2 * static_cast<unsigned>(bits) + 256 > bigint_max_bits)
+            throw std::invalid_argument("RSA key size exceeds the BigInt backend capacity.");
+        // Privremene vrednosti (Miller-Rabin, egcd, modexp) se brišu iz arene na kraju operacije
+        ArenaScope scope;
 
         int half = bits / 2;
-        BigInt p = generate_prime(half);
-        BigInt q = generate_prime(half);
-        while (q == p) { q = generate_prime(half); }
+        BigInt p = next_prime(half);
+        BigInt q = next_prime(half);
+        while (q == p) { q = next_prime(half); }
 
         BigInt n = p * q;
         BigInt phi = (p - 1) * (q - 1);
@@ -31,15 +264,19 @@ namespace CryptoLib {
         }
 
         BigInt d = modinv(e, phi);
+        secure_wipe(p);
+        secure_wipe(q);
+        secure_wipe(phi);
 
         RSAKeyPair kp;
         kp.public_key = PublicKey{ n, e };
-        kp.private_key = PrivateKey{ n, d };
+        kp.private_key = PrivateKey{ n, d, e };
         return kp;
     }
 
     std::vector<std::uint8_t> RSA::encrypt(const std::vector<std::uint8_t>& plaintext,
                                            const PublicKey& pub) {
+        ArenaScope scope;
         if (pub.n == 0 || pub.e == 0) throw std::invalid_argument("Invalid public key.");
         BigInt m = bytes_to_bigint(plaintext);
         if (m >= pub.n) throw std::invalid_argument("Plaintext too large for modulus.");
@@ -49,21 +286,44 @@ namespace CryptoLib {
 
     std::vector<std::uint8_t> RSA::decrypt(const std::vector<std::uint8_t>& ciphertext,
                                            const PrivateKey& priv) {
+        ArenaScope scope;
         if (priv.n == 0 || priv.d == 0) throw std::invalid_argument("Invalid private key.");
         BigInt c = bytes_to_bigint(ciphertext);
         if (c >= priv.n) throw std::invalid_argument("Ciphertext >= modulus.");
-        BigInt m = modexp(c, priv.d, priv.n);
+        BigInt m = private_op(c, priv);
         return bigint_to_bytes(m);
     }
 
+    std::vector<std::vector<std::uint8_t>> RSA::decrypt_batch(const std::vector<std::vector<std::uint8_t>>& ciphertexts,
+                                                              const PrivateKey& priv) {
+        ArenaScope scope;
+        if (priv.n == 0 || priv.d == 0) throw std::invalid_argument("Invalid private key.");
+        std::vector<BigInt> cs;
+        cs.reserve(ciphertexts.size());
+        for (const auto& ct : ciphertexts) {
+            cs.push_back(bytes_to_bigint(ct));
+            if (cs.back() >= priv.n) throw std::invalid_argument("Ciphertext >= modulus.");
+        }
+        std::vector<BigInt> ms = private_op_batch(std::move(cs), priv);
+        std::vector<std::vector<std::uint8_t>> out;
+        out.reserve(ms.size());
+        for (auto& m : ms) {
+            out.push_back(bigint_to_bytes(m));
+            secure_wipe(m);
+        }
+        return out;
+    }
+
+    template <class Hash>
     std::vector<std::uint8_t> RSA::encrypt_string(const std::string& plaintext,
                                                   const PublicKey& pub) {
         const auto k = bigint_to_bytes(pub.n).size();
         const std::vector<std::uint8_t> msg(plaintext.begin(), plaintext.end());
-        auto em = oaep_encode(msg, k);
+        auto em = oaep_encode<Hash>(msg, k);
         return encrypt(em, pub);
     }
 
+    template <class Hash>
     std::string RSA::decrypt_to_string(const std::vector<std::uint8_t>& ciphertext,
                                        const PrivateKey& priv) {
         const auto k = bigint_to_bytes(priv.n).size();
@@ -75,26 +335,48 @@ namespace CryptoLib {
         } else if (em.size() > k) {
             throw std::runtime_error("Decrypted block larger than modulus length");
         }
-        auto msg = oaep_decode(em, k);
+        auto msg = oaep_decode<Hash>(em, k);
         return std::string(msg.begin(), msg.end());
     }
 
+    template <class Hash>
     std::vector<std::uint8_t> RSA::sign(const std::string& message, const PrivateKey& priv) {
+        ArenaScope scope;
         std::vector<std::uint8_t> msg_bytes(message.begin(), message.end());
-        auto hash = sha256(msg_bytes);
+        auto hash = Hash::hash(msg_bytes);
 
         BigInt m = bytes_to_bigint(hash);
         if (m >= priv.n) throw std::invalid_argument("Hash too large for modulus");
 
-        BigInt s = modexp(m, priv.d, priv.n);
+        BigInt s = private_op(m, priv);
         return bigint_to_bytes(s);
     }
 
+    template <class Hash>
+    std::vector<std::vector<std::uint8_t>> RSA::sign_batch(const std::vector<std::string>& messages,
+                                                           const PrivateKey& priv) {
+        ArenaScope scope;
+        std::vector<BigInt> ms;
+        ms.reserve(messages.size());
+        for (const auto& message : messages) {
+            std::vector<std::uint8_t> msg_bytes(message.begin(), message.end());
+            ms.push_back(bytes_to_bigint(Hash::hash(msg_bytes)));
+            if (ms.back() >= priv.n) throw std::invalid_argument("Hash too large for modulus");
+        }
+        std::vector<BigInt> ss = private_op_batch(std::move(ms), priv);
+        std::vector<std::vector<std::uint8_t>> out;
+        out.reserve(ss.size());
+        for (const auto& s : ss) out.push_back(bigint_to_bytes(s));
+        return out;
+    }
+
+    template <class Hash>
     bool RSA::verify(const std::string& message,
                      const std::vector<std::uint8_t>& signature,
                      const PublicKey& pub) {
+        ArenaScope scope;
         std::vector<std::uint8_t> msg_bytes(message.begin(), message.end());
-        auto hash = sha256(msg_bytes);
+        auto hash = Hash::hash(msg_bytes);
 
         BigInt s = bytes_to_bigint(signature);
         if (s >= pub.n) return false;
@@ -112,4 +394,37 @@ namespace CryptoLib {
         return recovered == hash;
     }
 
+#define CRYPTOLIB_RSA_INSTANTIATE(H)                                                                          \
+    template std::vector<std::uint8_t> RSA::encrypt_string<H>(const std::string&, const PublicKey&);          \
+    template std::string RSA::decrypt_to_string<H>(const std::vector<std::uint8_t>&, const PrivateKey&);      \
+    template std::vector<std::uint8_t> RSA::sign<H>(const std::string&, const PrivateKey&);                   \
+    template std::vector<std::vector<std::uint8_t>> RSA::sign_batch<H>(const std::vector<std::string>&,       \
+                                                                       const PrivateKey&);                    \
+    template bool RSA::verify<H>(const std::string&, const std::vector<std::uint8_t>&, const PublicKey&);
+
+    CRYPTOLIB_RSA_INSTANTIATE(Sha256)
+    CRYPTOLIB_RSA_INSTANTIATE(Sha384)
+    CRYPTOLIB_RSA_INSTANTIATE(Sha512)
+#undef CRYPTOLIB_RSA_INSTANTIATE
+
+    std::vector<std::uint8_t> RSA::encrypt_string(const std::string& plaintext, const PublicKey& pub) {
+        return encrypt_string<Sha256>(plaintext, pub);
+    }
+
+    std::string RSA::decrypt_to_string(const std::vector<std::uint8_t>& ciphertext, const PrivateKey& priv) {
+        return decrypt_to_string<Sha256>(ciphertext, priv);
+    }
+
+    std::vector<std::uint8_t> RSA::sign(const std::string& message, const PrivateKey& priv) {
+        return sign<Sha256>(message, priv);
+    }
+
+    std::vector<std::vector<std::uint8_t>> RSA::sign_batch(const std::vector<std::string>& messages, const PrivateKey& priv) {
+        return sign_batch<Sha256>(messages, priv);
+    }
+
+    bool RSA::verify(const std::string& message, const std::vector<std::uint8_t>& signature, const PublicKey& pub) {
+        return verify<Sha256>(message, signature, pub);
+    }
+
 } // namespace CryptoLib
\ No newline at end of file
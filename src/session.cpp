@@ -0,0 +1,154 @@
+#include "session.hpp"
+#include "oaep.hpp"
+#include "random_utils.hpp"
+#include "utils.hpp"
+#include <stdexcept>
+
+namespace CryptoLib {
+
+    static std::size_t modulus_bytes(const BigInt& n) {
+        return msb(n) / 8 + 1;
+    }
+
+    static void put_be(std::uint8_t* out, std::uint64_t v, std::size_t len) {
+        for (std::size_t i = 0; i < len; ++i) out[len - 1 - i] = static_cast<std::uint8_t>(v >> (8 * i));
+    }
+
+    static std::uint64_t get_be(const std::uint8_t* in, std::size_t len) {
+        std::uint64_t v = 0;
+        for (std::size_t i = 0; i < len; ++i) v = (v << 8) | in[i];
+        return v;
+    }
+
+    static std::vector<std::uint8_t> encapsulate(const PublicKey& pub, const std::vector<std::uint8_t>& key,
+                                                 std::uint32_t epoch) {
+        std::vector<std::uint8_t> payload(key);
+        payload.resize(key.size() + 4);
+        put_be(payload.data() + key.size(), epoch, 4);
+        auto em = oaep_encode(payload, modulus_bytes(pub.n));
+        secure_wipe(payload);
+        auto c = RSA::encrypt(em, pub);
+        secure_wipe(em);
+        return c;
+    }
+
+    // Vraća ključ sesije; epoha se upisuje u `epoch`
+    static std::vector<std::uint8_t> decapsulate(const PrivateKey& priv, const std::vector<std::uint8_t>& c,
+                                                 std::uint32_t& epoch) {
+        const std::size_t k = modulus_bytes(priv.n);
+        auto em = RSA::decrypt(c, priv);
+        if (em.size() > k) throw std::runtime_error("Decrypted block larger than modulus length");
+        em.insert(em.begin(), k - em.size(), 0x00);
+        auto payload = oaep_decode(em, k);
+        secure_wipe(em);
+        if (payload.size() != Aes256Gcm::key_size + 4) {
+            secure_wipe(payload);
+            throw std::runtime_error("Session: invalid encapsulated key");
+        }
+        epoch = static_cast<std::uint32_t>(get_be(payload.data() + Aes256Gcm::key_size, 4));
+        payload.resize(Aes256Gcm::key_size);
+        return payload;
+    }
+
+    // ---- SessionSender ----
+
+    SessionSender::SessionSender(const PublicKey& recipient, const SessionLimits& limits)
+        : recipient_(recipient), limits_(limits) {
+        if (recipient_.n == 0 || recipient_.e == 0) throw std::invalid_argument("Invalid public key.");
+        if (limits_.max_messages == 0) throw std::invalid_argument("SessionSender: max_messages must be > 0");
+        std::vector<std::uint8_t> key(Aes256Gcm::key_size);
+        csprng_bytes(key);
+        encapsulated_ = encapsulate(recipient_, key, epoch_);
+        aead_ = std::make_unique<Aes256Gcm>(key);
+        secure_wipe(key);
+    }
+
+    const std::vector<std::uint8_t>& SessionSender::rekey() {
+        if (epoch_ == UINT32_MAX) throw std::runtime_error("SessionSender: epoch exhausted");
+        std::vector<std::uint8_t> key(Aes256Gcm::key_size);
+        csprng_bytes(key);
+        encapsulated_ = encapsulate(recipient_, key, epoch_ + 1);
+        aead_ = std::make_unique<Aes256Gcm>(key);
+        secure_wipe(key);
+        ++epoch_;
+        messages_ = 0;
+        bytes_ = 0;
+        return encapsulated_;
+    }
+
+    bool SessionSender::needs_rekey(std::size_t bytes) const {
+        return messages_ >= limits_.max_messages || bytes > limits_.max_bytes - bytes_;
+    }
+
+    std::vector<std::uint8_t> SessionSender::seal(const std::vector<std::uint8_t>& plaintext,
+                                                  const std::vector<std::uint8_t>& aad) {
+        if (needs_rekey(plaintext.size())) throw std::runtime_error("SessionSender: key limits reached, rekey required");
+
+        std::vector<std::uint8_t> out(session_header_size);
+        put_be(out.data(), epoch_, 4);
+        put_be(out.data() + 4, messages_, 8);
+        auto body = aead_->seal(out, aad, plaintext);
+        ++messages_;
+        bytes_ += plaintext.size();
+
+        out.insert(out.end(), body.begin(), body.end());
+        return out;
+    }
+
+    std::vector<std::uint8_t> SessionSender::seal_string(const std::string& plaintext) {
+        return seal(std::vector<std::uint8_t>(plaintext.begin(), plaintext.end()));
+    }
+
+    // ---- SessionReceiver ----
+
+    SessionReceiver::SessionReceiver(const PrivateKey& priv, const std::vector<std::uint8_t>& encapsulated_key,
+                                     const SessionLimits& limits)
+        : priv_(priv), limits_(limits) {
+        if (priv_.n == 0 || priv_.d == 0) throw std::invalid_argument("Invalid private key.");
+        rekey(encapsulated_key);
+    }
+
+    void SessionReceiver::rekey(const std::vector<std::uint8_t>& encapsulated_key) {
+        std::uint32_t epoch = 0;
+        auto key = decapsulate(priv_, encapsulated_key, epoch);
+        if (have_key_ && epoch <= epoch_) {
+            secure_wipe(key);
+            throw std::runtime_error("SessionReceiver: stale or replayed session key");
+        }
+        aead_ = std::make_unique<Aes256Gcm>(key);
+        secure_wipe(key);
+        epoch_ = epoch;
+        have_key_ = true;
+        next_counter_ = 0;
+        bytes_ = 0;
+    }
+
+    std::vector<std::uint8_t> SessionReceiver::open(const std::vector<std::uint8_t>& sealed,
+                                                    const std::vector<std::uint8_t>& aad) {
+        if (sealed.size() < session_header_size + Aes256Gcm::tag_size)
+            throw std::runtime_error("SessionReceiver: message too short");
+
+        const std::uint32_t epoch = static_cast<std::uint32_t>(get_be(sealed.data(), 4));
+        const std::uint64_t counter = get_be(sealed.data() + 4, 8);
+        if (epoch != epoch_) throw std::runtime_error("SessionReceiver: message from a different epoch");
+        if (counter < next_counter_) throw std::runtime_error("SessionReceiver: replayed or out-of-order message");
+        if (counter >= limits_.max_messages) throw std::runtime_error("SessionReceiver: message exceeds key limits");
+        const std::size_t len = sealed.size() - session_header_size - Aes256Gcm::tag_size;
+        if (len > limits_.max_bytes - bytes_) throw std::runtime_error("SessionReceiver: message exceeds key limits");
+
+        const std::vector<std::uint8_t> nonce(sealed.begin(), sealed.begin() + session_header_size);
+        const std::vector<std::uint8_t> body(sealed.begin() + session_header_size, sealed.end());
+        auto plain = aead_->open(nonce, aad, body);
+
+        // Stanje se menja tek posle uspešne autentifikacije
+        next_counter_ = counter + 1;
+        bytes_ += plain.size();
+        return plain;
+    }
+
+    std::string SessionReceiver::open_string(const std::vector<std::uint8_t>& sealed) {
+        auto plain = open(sealed);
+        return std::string(plain.begin(), plain.end());
+    }
+
+} // namespace CryptoLib
@@ -1,13 +1,19 @@
 #include "utils.hpp"
-#include <sstream>
-#include <iomanip>
+#include "encoding.hpp"
 
 namespace CryptoLib {
     std::string to_hex(const std::string& input) {
-        std::ostringstream oss;
-        for (unsigned char c : input) {
-            oss << std::hex << std::setw(2) << std::setfill('0') << (int)c;
-        }
-        return oss.str();
+        std::string out(hex_encoded_size(input.size()), '\0');
+        hex_encode(reinterpret_cast<const std::uint8_t*>(input.data()), input.size(), &out[0]);
+        return out;
+    }
+
+    void secure_wipe(std::vector<std::uint8_t>& buf) {
+        secure_wipe(buf.data(), buf.size());
+    }
+
+    void secure_wipe(std::uint8_t* buf, std::size_t len) {
+        volatile std::uint8_t* p = buf;
+        for (std::size_t i = 0; i < len; ++i) p[i] = 0;
     }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "rsa.hpp"
 #include "bigint_utils.hpp"
+#include "montgomery.hpp"
 #include <iostream>
 #include <chrono>
 #include <string>
@@ -9,42 +10,54 @@
 using namespace CryptoLib;
 using namespace std::chrono;
 
-static void benchmark_rsa(int bits, const std::string& msg, std::ofstream& csv) {
+static void benchmark_rsa(int bits, const std::vector<std::string>& messages, std::ofstream& csv) {
     std::cout << "\n[INFO] Benchmark RSA " << bits << " bits\n";
 
+    // KeyGen jednom po veličini ključa (8192 bita traje desetinama sekundi)
+    RSAKeyPair keys;
+    long long keygen_ms = 0;
     try {
-        // KeyGen
         auto t1 = high_resolution_clock::now();
-        auto keys = RSA::generate_keys(bits);
+        keys = RSA::generate_keys(bits);
         auto t2 = high_resolution_clock::now();
-        auto keygen_ms = duration_cast<milliseconds>(t2 - t1).count();
+        keygen_ms = duration_cast<milliseconds>(t2 - t1).count();
         std::cout << "KeyGen:      " << keygen_ms << " ms\n";
+    }
+    catch (const std::exception& ex) {
+        std::cerr << "[ERROR] RSA keygen failed: " << ex.what() << "\n";
+        for (const auto& msg : messages)
+            csv << bits << "," << msg.size() << ",ERR,ERR,ERR,ERROR\n";
+        return;
+    }
 
-        // Encrypt
-        t1 = high_resolution_clock::now();
-        auto enc = RSA::encrypt_string(msg, keys.public_key);
-        t2 = high_resolution_clock::now();
-        auto encrypt_ms = duration_cast<milliseconds>(t2 - t1).count();
-        std::cout << "Encrypt:     " << encrypt_ms << " ms\n";
+    for (const auto& msg : messages) {
+        try {
+            // Encrypt
+            auto t1 = high_resolution_clock::now();
+            auto enc = RSA::encrypt_string(msg, keys.public_key);
+            auto t2 = high_resolution_clock::now();
+            auto encrypt_ms = duration_cast<milliseconds>(t2 - t1).count();
+            std::cout << "Encrypt:     " << encrypt_ms << " ms (len=" << msg.size() << ")\n";
 
-        // Decrypt
-        t1 = high_resolution_clock::now();
-        auto dec = RSA::decrypt_to_string(enc, keys.private_key);
-        t2 = high_resolution_clock::now();
-        auto decrypt_ms = duration_cast<milliseconds>(t2 - t1).count();
-        std::cout << "Decrypt:     " << decrypt_ms << " ms\n";
+            // Decrypt
+            t1 = high_resolution_clock::now();
+            auto dec = RSA::decrypt_to_string(enc, keys.private_key);
+            t2 = high_resolution_clock::now();
+            auto decrypt_ms = duration_cast<milliseconds>(t2 - t1).count();
+            std::cout << "Decrypt:     " << decrypt_ms << " ms (len=" << msg.size() << ")\n";
 
-        bool ok = (dec == msg);
-        std::cout << (ok ? "[PASS]" : "[FAIL]") << " Round-trip\n";
+            bool ok = (dec == msg);
+            std::cout << (ok ? "[PASS]" : "[FAIL]") << " Round-trip\n";
 
-        // Upis u CSV
-        csv << bits << "," << msg.size() << "," 
-            << keygen_ms << "," << encrypt_ms << "," << decrypt_ms << "," 
-            << (ok ? "OK" : "FAIL") << "\n";
-    }
-    catch (const std::exception& ex) {
-        std::cerr << "[ERROR] RSA failed: " << ex.what() << "\n";
-        csv << bits << "," << msg.size() << ",ERR,ERR,ERR,ERROR\n";
+            // Upis u CSV
+            csv << bits << "," << msg.size() << ","
+                << keygen_ms << "," << encrypt_ms << "," << decrypt_ms << ","
+                << (ok ? "OK" : "FAIL") << "\n";
+        }
+        catch (const std::exception& ex) {
+            std::cerr << "[ERROR] RSA failed: " << ex.what() << "\n";
+            csv << bits << "," << msg.size() << ",ERR,ERR,ERR,ERROR\n";
+        }
     }
 }
 
@@ -55,6 +68,8 @@ int main() {
         return 1;
     }
     csv << "KeyBits,MsgLen,KeyGenMS,EncryptMS,DecryptMS,Status\n";
+    std::cout << "[INFO] BigInt backend: " << bigint_backend_name() << "\n";
+    std::cout << "[INFO] Montgomery kernel: " << mont_kernel_name(get_mont_kernel()) << "\n";
 
     const std::vector<std::string> messages = {
         "Hi",
@@ -62,9 +77,8 @@ int main() {
         std::string(190, 'X') // max za 2048-bitni ključ
     };
 
-    for (const auto& msg : messages) {
-        benchmark_rsa(1024, msg, csv);
-        benchmark_rsa(2048, msg, csv);
+    for (int bits : { 1024, 2048, 3072, 4096, 8192 }) {
+        benchmark_rsa(bits, messages, csv);
     }
 
     csv.close();
@@ -0,0 +1,215 @@
+#include "rsa.hpp"
+#include "aead.hpp"
+#include "random_utils.hpp"
+#include "montgomery.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <cstdlib>
+
+using namespace CryptoLib;
+using namespace std::chrono;
+
+// Propusnost RSA operacija na 1..N niti, sa jednim deljenim ključem i sa ključem po niti.
+// Efikasnost skaliranja = ops/s na N niti / (N * ops/s na jednoj niti); pad ispod ~0.9
+// na mašini sa N slobodnih jezgara ukazuje na zajedničko stanje ili zaključavanje.
+// Svaka operacija se proverava, pa benchmark ujedno hvata i neispravno deljeno stanje.
+//
+// Upotreba: benchmark_throughput [max_niti] [bitovi] [sekundi_po_merenju]
+
+struct ThreadInput {
+    const RSAKeyPair* keys = nullptr;
+    std::size_t modulus_bytes = 0;
+    std::vector<std::uint8_t> ciphertext; // za decrypt
+    std::vector<std::uint8_t> signature;  // za verify
+    const Aes256Gcm* aead = nullptr;
+};
+
+// Jedna operacija; vraća false ako rezultat nije ispravan
+using Operation = std::function<bool(const ThreadInput&, unsigned thread, std::uint64_t iteration)>;
+
+static const std::string message = "Poruka za merenje propusnosti RSA operacija.";
+
+static std::vector<unsigned> thread_counts(unsigned max_threads) {
+    std::vector<unsigned> counts;
+    for (unsigned n = 1; n < max_threads; n *= 2) counts.push_back(n);
+    counts.push_back(max_threads);
+    return counts;
+}
+
+struct RunResult {
+    double ops_per_sec = 0;
+    std::uint64_t failures = 0;
+};
+
+static RunResult run(const Operation& op, const std::vector<ThreadInput>& inputs, unsigned threads, double seconds) {
+    std::atomic<bool> go{ false };
+    std::atomic<bool> stop{ false };
+    std::atomic<unsigned> ready{ 0 };
+    std::vector<std::uint64_t> ops(threads, 0), failures(threads, 0);
+    std::vector<std::thread> workers;
+
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            std::uint64_t n = 0, bad = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (!op(inputs[t], t, n)) ++bad;
+                ++n;
+            }
+            ops[t] = n;
+            failures[t] = bad;
+        });
+    }
+
+    while (ready.load() != threads) std::this_thread::yield();
+    auto t1 = steady_clock::now();
+    go.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(duration<double>(seconds));
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& w : workers) w.join();
+    auto t2 = steady_clock::now();
+
+    RunResult r;
+    std::uint64_t total = 0;
+    for (unsigned t = 0; t < threads; ++t) {
+        total += ops[t];
+        r.failures += failures[t];
+    }
+    r.ops_per_sec = total / duration<double>(t2 - t1).count();
+    return r;
+}
+
+// Svaka nit generiše svoj ključ, da priprema ne traje N puta duže od jednog keygen-a
+static std::vector<RSAKeyPair> generate_keys_parallel(unsigned count, int bits) {
+    std::vector<RSAKeyPair> keys(count);
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < count; ++i)
+        workers.emplace_back([&keys, i, bits] { keys[i] = RSA::generate_keys(bits); });
+    for (auto& w : workers) w.join();
+    return keys;
+}
+
+static std::vector<ThreadInput> make_inputs(const std::vector<const RSAKeyPair*>& keys,
+                                            const std::vector<const Aes256Gcm*>& aeads) {
+    std::vector<ThreadInput> inputs(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        inputs[i].keys = keys[i];
+        inputs[i].modulus_bytes = bigint_to_bytes(keys[i]->public_key.n).size();
+        inputs[i].ciphertext = RSA::encrypt_string(message, keys[i]->public_key);
+        inputs[i].signature = RSA::sign(message, keys[i]->private_key);
+        inputs[i].aead = aeads[i];
+    }
+    return inputs;
+}
+
+int main(int argc, char** argv) {
+    unsigned max_threads = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : std::thread::hardware_concurrency();
+    const int bits = argc > 2 ? std::atoi(argv[2]) : 2048;
+    const double seconds = argc > 3 ? std::atof(argv[3]) : 1.0;
+    if (max_threads == 0) max_threads = 1;
+
+    std::ofstream csv("throughput_benchmark.csv", std::ios::out);
+    if (!csv.is_open()) {
+        std::cerr << "Ne mogu da otvorim throughput_benchmark.csv\n";
+        return 1;
+    }
+    csv << "Operation,Keys,Threads,OpsPerSec,Efficiency,Failures\n";
+
+    std::cout << "[INFO] BigInt backend: " << bigint_backend_name() << "\n";
+    std::cout << "[INFO] Montgomery kernel: " << mont_kernel_name(get_mont_kernel()) << "\n";
+    std::cout << "[INFO] RSA " << bits << " bits, do " << max_threads << " niti, "
+              << seconds << " s po merenju\n";
+    if (max_threads > std::thread::hardware_concurrency())
+        std::cout << "[WARN] više niti nego jezgara (" << std::thread::hardware_concurrency()
+                  << "); efikasnost iznad tog broja nije merodavna\n";
+
+    try {
+        // Ključ 0 je deljeni; ostali su po jedan za svaku nit
+        const std::vector<RSAKeyPair> keys = generate_keys_parallel(max_threads, bits);
+
+        std::vector<std::unique_ptr<Aes256Gcm>> aeads;
+        for (unsigned i = 0; i < max_threads; ++i) {
+            std::vector<std::uint8_t> key(Aes256Gcm::key_size);
+            csprng_bytes(key);
+            aeads.push_back(std::make_unique<Aes256Gcm>(key));
+        }
+
+        std::vector<const RSAKeyPair*> shared_keys(max_threads, &keys[0]), own_keys;
+        std::vector<const Aes256Gcm*> shared_aead(max_threads, aeads[0].get()), own_aead;
+        for (unsigned i = 0; i < max_threads; ++i) {
+            own_keys.push_back(&keys[i]);
+            own_aead.push_back(aeads[i].get());
+        }
+        const std::vector<ThreadInput> shared_inputs = make_inputs(shared_keys, shared_aead);
+        const std::vector<ThreadInput> own_inputs = make_inputs(own_keys, own_aead);
+
+        const std::vector<std::pair<std::string, Operation>> operations = {
+            { "encrypt", [](const ThreadInput& in, unsigned, std::uint64_t) {
+                  const auto c = RSA::encrypt_string(message, in.keys->public_key);
+                  return !c.empty() && c.size() <= in.modulus_bytes;
+              } },
+            { "decrypt", [](const ThreadInput& in, unsigned, std::uint64_t) {
+                  return RSA::decrypt_to_string(in.ciphertext, in.keys->private_key) == message;
+              } },
+            { "sign", [](const ThreadInput& in, unsigned, std::uint64_t) {
+                  return RSA::sign(message, in.keys->private_key) == in.signature;
+              } },
+            { "verify", [](const ThreadInput& in, unsigned, std::uint64_t) {
+                  return RSA::verify(message, in.signature, in.keys->public_key);
+              } },
+            // Aes256Gcm objekat deljen između niti; slučajan nonce se ne ponavlja ni između merenja
+            { "gcm-1KiB", [](const ThreadInput& in, unsigned thread, std::uint64_t i) {
+                  std::vector<std::uint8_t> nonce(Aes256Gcm::nonce_size);
+                  csprng_bytes(nonce);
+                  const std::vector<std::uint8_t> pt(1024, static_cast<std::uint8_t>(thread + i));
+                  return in.aead->open(nonce, {}, in.aead->seal(nonce, {}, pt)) == pt;
+              } },
+        };
+
+        std::uint64_t total_failures = 0;
+        for (const auto& op : operations) {
+            for (int mode = 0; mode < 2; ++mode) {
+                const char* mode_name = mode == 0 ? "shared" : "per-thread";
+                const auto& inputs = mode == 0 ? shared_inputs : own_inputs;
+                std::cout << "\n[INFO] " << op.first << " (" << mode_name << " key)\n";
+
+                double single = 0;
+                for (unsigned n : thread_counts(max_threads)) {
+                    RunResult r = run(op.second, inputs, n, seconds);
+                    if (n == 1) single = r.ops_per_sec;
+                    const double efficiency = single > 0 ? r.ops_per_sec / (n * single) : 0;
+                    total_failures += r.failures;
+
+                    std::cout << "  threads " << std::setw(3) << n << ": " << std::fixed << std::setprecision(1)
+                              << std::setw(10) << r.ops_per_sec << " ops/s, efficiency "
+                              << std::setprecision(2) << efficiency;
+                    if (r.failures) std::cout << "  [FAIL] " << r.failures << " neispravnih rezultata";
+                    std::cout << "\n";
+
+                    csv << op.first << "," << mode_name << "," << n << "," << r.ops_per_sec << ","
+                        << efficiency << "," << r.failures << "\n";
+                }
+            }
+        }
+
+        csv.close();
+        std::cout << "\nBenchmark zapisano u throughput_benchmark.csv\n";
+        if (total_failures) {
+            std::cerr << "[FAIL] " << total_failures << " neispravnih rezultata pri paralelnom radu\n";
+            return 1;
+        }
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "[ERROR] " << ex.what() << std::endl;
+        return 1;
+    }
+}
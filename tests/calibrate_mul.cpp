@@ -0,0 +1,108 @@
+#include "mul_utils.hpp"
+#include "bigint_utils.hpp"
+#include "prime_utils.hpp"
+#include "montgomery.hpp"
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <functional>
+
+using namespace CryptoLib;
+using namespace std::chrono;
+
+static const int limb_bits = sizeof(boost::multiprecision::limb_type) * 8;
+
+// Prosečno vreme jednog poziva u mikrosekundama (ponavlja dok ne prođe ~50 ms)
+static double time_us(const std::function<void()>& f) {
+    int reps = 0;
+    auto t1 = steady_clock::now();
+    double elapsed = 0;
+    do {
+        f();
+        ++reps;
+        elapsed = duration<double, std::micro>(steady_clock::now() - t1).count();
+    } while (elapsed < 50000.0);
+    return elapsed / reps;
+}
+
+// Bira prag koji daje najmanje ukupno vreme na veličinama 2048/4096/8192 bita
+static std::size_t calibrate_karatsuba(bool squaring, const std::vector<std::size_t>& candidates) {
+    const std::vector<int> sizes = { 2048 / limb_bits, 4096 / limb_bits, 8192 / limb_bits };
+    std::vector<BigInt> a, b;
+    for (auto limbs : sizes) {
+        a.push_back(random_bigint_bits(limbs * limb_bits));
+        b.push_back(random_bigint_bits(limbs * limb_bits));
+    }
+
+    std::size_t best = candidates.front();
+    double best_time = 0;
+    for (auto cand : candidates) {
+        MulThresholds t = get_mul_thresholds();
+        (squaring ? t.karatsuba_sqr : t.karatsuba_mul) = cand;
+        set_mul_thresholds(t);
+
+        double total = 0;
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            BigInt r;
+            total += squaring ? time_us([&] { r = sqr(a[i]); })
+                              : time_us([&] { r = mul(a[i], b[i]); });
+        }
+        std::cout << (squaring ? "  sqr" : "  mul") << " prag=" << cand << ": " << total << " us\n";
+        if (best_time == 0 || total < best_time) {
+            best_time = total;
+            best = cand;
+        }
+    }
+    return best;
+}
+
+// Najmanja veličina modula (u bitovima) od koje je Barrett brži od deljenja
+static std::size_t calibrate_barrett() {
+    const std::size_t off = 1u << 20;
+    for (int bits : { 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096 }) {
+        BigInt m = random_bigint_bits(bits);
+        BigInt base = random_bigint_bits(bits - 1);
+        BigInt e = random_bigint_bits(256);
+
+        MulThresholds t = get_mul_thresholds();
+        t.barrett = off;
+        set_mul_thresholds(t);
+        double div_us = time_us([&] { modexp(base, e, m); });
+
+        t.barrett = 1;
+        set_mul_thresholds(t);
+        double bar_us = time_us([&] { modexp(base, e, m); });
+
+        std::cout << "  modexp " << bits << " bita: deljenje " << div_us
+                  << " us, Barrett " << bar_us << " us\n";
+        if (bar_us < div_us) return limb_count(m);
+    }
+    return off;
+}
+
+int main() {
+    const std::vector<std::size_t> candidates = { 8, 12, 16, 24, 32, 48, 64 };
+
+    std::cout << "[INFO] Kalibracija Karatsuba praga za mnozenje\n";
+    std::size_t kmul = calibrate_karatsuba(false, candidates);
+    std::cout << "[INFO] Kalibracija Karatsuba praga za kvadriranje\n";
+    std::size_t ksqr = calibrate_karatsuba(true, candidates);
+
+    MulThresholds t = get_mul_thresholds();
+    t.karatsuba_mul = kmul;
+    t.karatsuba_sqr = ksqr;
+    set_mul_thresholds(t);
+
+    // Barrett se koristi samo kada Montgomery nije izabran (ili je modul paran)
+    std::cout << "[INFO] Kalibracija Barrett praga\n";
+    set_mont_kernel(MontKernel::None);
+    t.barrett = calibrate_barrett();
+    set_mont_kernel(detect_mont_kernel());
+    set_mul_thresholds(t);
+
+    std::cout << "\nPreporuceni pragovi (limbova):\n";
+    std::cout << "  karatsuba_mul = " << t.karatsuba_mul << "\n";
+    std::cout << "  karatsuba_sqr = " << t.karatsuba_sqr << "\n";
+    std::cout << "  barrett       = " << t.barrett << "\n";
+    return 0;
+}
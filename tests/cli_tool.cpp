@@ -1,35 +1,14 @@
 #include "rsa.hpp"
 #include "hash_utils.hpp"
+#include "encoding.hpp"
+#include "manifest.hpp"
 #include <iostream>
 #include <string>
-#include <sstream>
-#include <iomanip>
 #include <vector>
 #include <fstream>
 
 using namespace CryptoLib;
 
-// Pretvaranje bajtova u hex string
-std::string to_hex(const std::vector<std::uint8_t>& data) {
-    std::ostringstream oss;
-    for (auto b : data) {
-        oss << std::hex << std::setw(2) << std::setfill('0') << (int)b;
-    }
-    return oss.str();
-}
-
-// Pretvaranje hex stringa u bajtove
-std::vector<std::uint8_t> from_hex(const std::string& hex) {
-    std::vector<std::uint8_t> out;
-    if (hex.size() % 2 != 0) throw std::invalid_argument("Neparan broj hex karaktera");
-    for (size_t i = 0; i < hex.size(); i += 2) {
-        std::string byteStr = hex.substr(i, 2);
-        std::uint8_t byte = (std::uint8_t) std::stoul(byteStr, nullptr, 16);
-        out.push_back(byte);
-    }
-    return out;
-}
-
 // Učitavanje fajla u bajtove
 std::vector<std::uint8_t> read_file(const std::string& path) {
     std::ifstream ifs(path, std::ios::binary);
@@ -64,6 +43,8 @@ void menu() {
     std::cout << "7) Dekripcija fajla\n";
     std::cout << "8) Potpisivanje fajla\n";
     std::cout << "9) Verifikacija potpisa fajla\n";
+    std::cout << "10) Potpisivanje direktorijuma (manifest)\n";
+    std::cout << "11) Verifikacija direktorijuma (manifest)\n";
     std::cout << "0) Izlaz\n";
     std::cout << "Izbor: ";
 }
@@ -87,7 +68,7 @@ int main() {
                 if (choice == 0) break;
 
         if (choice == 1) {
-            std::cout << "Unesi velicinu kljuca (1024 ili 2048): ";
+            std::cout << "Unesi velicinu kljuca (1024, 2048, 3072, 4096 ili 8192): ";
             int bits;
             std::cin >> bits;
             std::cin.ignore();
@@ -102,7 +83,7 @@ int main() {
             std::getline(std::cin, msg);
             try {
                 auto enc = RSA::encrypt_string(msg, keys.public_key);
-                std::cout << "[ENCRYPTED HEX] " << to_hex(enc) << "\n";
+                std::cout << "[ENCRYPTED HEX] " << hex_encode(enc) << "\n";
             } catch (const std::exception& ex) {
                 std::cout << "[ERROR] " << ex.what() << "\n";
             }
@@ -113,7 +94,7 @@ int main() {
             std::string hex;
             std::getline(std::cin, hex);
             try {
-                auto enc = from_hex(hex);
+                auto enc = hex_decode(hex);
                 auto dec = RSA::decrypt_to_string(enc, keys.private_key);
                 std::cout << "[DECRYPTED] " << dec << "\n";
             } catch (const std::exception& ex) {
@@ -127,7 +108,7 @@ int main() {
             std::getline(std::cin, msg);
             try {
                 auto sig = RSA::sign(msg, keys.private_key);
-                std::cout << "[SIGNATURE HEX] " << to_hex(sig) << "\n";
+                std::cout << "[SIGNATURE HEX] " << hex_encode(sig) << "\n";
             } catch (const std::exception& ex) {
                 std::cout << "[ERROR] " << ex.what() << "\n";
             }
@@ -141,7 +122,7 @@ int main() {
             std::string hex;
             std::getline(std::cin, hex);
             try {
-                auto sig = from_hex(hex);
+                auto sig = hex_decode(hex);
                 bool ok = RSA::verify(msg, sig, keys.public_key);
                 std::cout << (ok ? "[PASS] Potpis validan\n" : "[FAIL] Potpis NIJE validan\n");
             } catch (const std::exception& ex) {
@@ -210,6 +191,48 @@ int main() {
                 std::cout << "[ERROR] " << ex.what() << "\n";
             }
         }
+        else if (choice == 10) {
+            if (!keys_generated) { std::cout << "[WARN] Prvo generisi kljuceve!\n"; continue; }
+            std::cout << "Unesi putanju do direktorijuma: ";
+            std::string dir;
+            std::getline(std::cin, dir);
+            dir = trim_quotes(dir);
+            while (dir.size() > 1 && (dir.back() == '/' || dir.back() == '\\')) dir.pop_back();
+            try {
+                // Manifest ide pored direktorijuma, ne u njega, da ne bi hesirao samog sebe
+                auto m = sign_directory(dir, keys.private_key);
+                write_file(dir + ".manifest", std::vector<std::uint8_t>(m.text.begin(), m.text.end()));
+                write_file(dir + ".manifest.sig", m.signature);
+                std::cout << "[INFO] Fajlova: " << parse_manifest(m.text).size() << "\n";
+                std::cout << "[INFO] Manifest sacuvan u: " << dir << ".manifest (+ .sig)\n";
+            } catch (const std::exception& ex) {
+                std::cout << "[ERROR] " << ex.what() << "\n";
+            }
+        }
+        else if (choice == 11) {
+            if (!keys_generated) { std::cout << "[WARN] Prvo generisi kljuceve!\n"; continue; }
+            std::cout << "Unesi putanju do direktorijuma: ";
+            std::string dir;
+            std::getline(std::cin, dir);
+            dir = trim_quotes(dir);
+            while (dir.size() > 1 && (dir.back() == '/' || dir.back() == '\\')) dir.pop_back();
+            try {
+                auto text = read_file(dir + ".manifest");
+                SignedManifest m{ std::string(text.begin(), text.end()), read_file(dir + ".manifest.sig") };
+                auto report = verify_directory(dir, m, keys.public_key);
+                if (!report.signature_ok) {
+                    std::cout << "[FAIL] Potpis manifesta NIJE validan\n";
+                    continue;
+                }
+                for (const auto& p : report.modified) std::cout << "[MODIFIED] " << p << "\n";
+                for (const auto& p : report.missing) std::cout << "[MISSING]  " << p << "\n";
+                for (const auto& p : report.added) std::cout << "[ADDED]    " << p << "\n";
+                std::cout << (report.ok() ? "[PASS] Direktorijum odgovara manifestu\n"
+                                          : "[FAIL] Direktorijum NE odgovara manifestu\n");
+            } catch (const std::exception& ex) {
+                std::cout << "[ERROR] " << ex.what() << "\n";
+            }
+        }
         else {
             std::cout << "[WARN] Nepoznata opcija.\n";
         }
@@ -0,0 +1,125 @@
+#include "arena.hpp"
+#include "bigint_utils.hpp"
+#include "prime_utils.hpp"
+#include "montgomery.hpp"
+#include "rsa.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+using namespace CryptoLib;
+
+// Brojač poziva globalnog alokatora (svih niti)
+static std::atomic<std::size_t> g_news{ 0 };
+
+// GCC ne vidi da su zamenjeni new i delete par (malloc/free), pa lažno javlja neslaganje
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void* operator new(std::size_t size) {
+    ++g_news;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// ArenaBigInt računa isto što i BigInt; na kraju opsega arena je prazna
+static void test_scope_and_reset() {
+    const BigInt a = random_bigint_bits(2048);
+    const BigInt b = random_bigint_bits(1500);
+    {
+        ArenaScope scope;
+        ArenaBigInt x(a), y(b);
+        ArenaBigInt z = x * y % (y + 1);
+        assert(BigInt(z) == a * b % (b + 1));
+        {
+            ArenaScope inner; // ugnežđen opseg ne sme da resetuje arenu
+            ArenaBigInt t = x + y;
+            assert(BigInt(t) == a + b);
+        }
+        assert(BigInt(z) == a * b % (b + 1));
+        assert(Arena::local().stats().in_use_bytes > 0);
+    }
+    assert(Arena::local().stats().in_use_bytes == 0);
+
+    bool threw = false;
+    try {
+        ArenaBigInt outside(a);
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "[PASS] ArenaScope nesting and reset\n";
+}
+
+// Broj poziva alokatora ne zavisi od dužine eksponenta, a arena ne traži nove blokove
+static void test_modexp_allocations() {
+    const BigInt m = random_bigint_bits(2048);
+    const BigInt base = random_bigint_bits(2000);
+    const BigInt short_e = 65537;
+    const BigInt long_e = random_bigint_bits(2048);
+
+    auto count = [&](const BigInt& e) {
+        modexp(base, e, m); // zagrevanje: blokovi arene, tabele
+        const std::size_t before = g_news.load();
+        const std::uint64_t sys_before = Arena::local().stats().system_allocations;
+        modexp(base, e, m);
+        assert(Arena::local().stats().system_allocations == sys_before);
+        return g_news.load() - before;
+    };
+    const std::size_t n_short = count(short_e);
+    const std::size_t n_long = count(long_e);
+    std::cout << "  allocations per modexp: e=65537 -> " << n_short << ", 2048-bit e -> " << n_long << "\n";
+    assert(n_short == n_long);
+    assert(n_long <= 4);
+
+    const BigInt p = generate_prime(512);
+    is_probable_prime(p, 32);
+    const std::size_t before = g_news.load();
+    assert(is_probable_prime(p, 32));
+    const std::size_t mr = g_news.load() - before;
+    std::cout << "  allocations per is_probable_prime (32 rounds): " << mr << "\n";
+    assert(mr == 0);
+    std::cout << "[PASS] modexp / Miller-Rabin allocation counts\n";
+}
+
+// Arena je po niti: paralelne RSA operacije ne dele stanje
+static void test_threads() {
+    RSAKeyPair kp = RSA::generate_keys(1024);
+    auto run = [&kp](int id) {
+        for (int i = 0; i < 20; ++i) {
+            const std::string msg = "thread " + std::to_string(id) + " message " + std::to_string(i);
+            auto c = RSA::encrypt_string(msg, kp.public_key);
+            assert(RSA::decrypt_to_string(c, kp.private_key) == msg);
+            assert(RSA::verify(msg, RSA::sign(msg, kp.private_key), kp.public_key));
+        }
+        assert(Arena::local().stats().in_use_bytes == 0);
+    };
+    std::thread t1(run, 1), t2(run, 2), t3(run, 3);
+    t1.join();
+    t2.join();
+    t3.join();
+    std::cout << "[PASS] per-thread arenas\n";
+}
+
+int main() {
+    try {
+        test_scope_and_reset();
+        test_modexp_allocations();
+        test_threads();
+    } catch (const std::exception& ex) {
+        std::cerr << "Test failed with exception: " << ex.what() << "\n";
+        return 1;
+    }
+    std::cout << "All arena tests passed.\n";
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include "bigint_utils.hpp"
+#include "prime_utils.hpp"
+#include <boost/multiprecision/integer.hpp>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <stdexcept>
+#include <cassert>
+
+using namespace CryptoLib;
+using namespace std::chrono;
+
+static void check_egcd(const BigInt& a, const BigInt& b) {
+    BigInt x, y;
+    const BigInt g = egcd(a, b, x, y);
+    assert(g == boost::multiprecision::gcd(a, b));
+    assert(a * x + b * y == g);
+}
+
+// Dužine oko granica reči (62/64 bita) i veliki količnici (a višestruko veće od b)
+static void test_egcd() {
+    for (int bits : { 2, 8, 61, 62, 63, 64, 65, 127, 128, 129, 521, 1024, 2048, 4096 }) {
+        for (int r = 0; r < 20; ++r) {
+            const BigInt a = random_bigint_bits(bits) >> (r % 4);
+            const BigInt b = random_bigint_bits(r % 3 == 0 ? bits : (bits + 1) / 2);
+            check_egcd(a, b);
+            check_egcd(b, a);
+            check_egcd(a * b * 6, b * 4);          // zajednički faktor, b deli a
+            check_egcd(-a, b);
+            check_egcd(a, -b);
+        }
+    }
+    check_egcd(0, 0);
+    check_egcd(5, 0);
+    check_egcd(0, 7);
+    check_egcd(1, 1);
+    std::cout << "[PASS] egcd\n";
+}
+
+static void test_modinv() {
+    const BigInt m = generate_prime(1024);
+    std::vector<BigInt> values;
+    for (int i = 0; i < 50; ++i) values.push_back(random_bigint_bits(i % 2 ? 1100 : 300));
+    values.push_back(1);
+    values.push_back(-values[0]);             // negativna vrednost
+    values.push_back(m - 1);
+
+    const auto inv = modinv_batch(values, m);
+    assert(inv.size() == values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(inv[i] == modinv(values[i], m));
+        BigInt one = values[i] * inv[i] % m;
+        if (one < 0) one += m;
+        assert(one == 1 && inv[i] >= 0 && inv[i] < m);
+    }
+    assert(modinv_batch({ 7 }, m)[0] == modinv(7, m));
+    assert(modinv_batch({}, m).empty());
+
+    // Jedan neinvertibilan element obara celu seriju, kao i modinv
+    auto throws_runtime = [](auto f) {
+        try {
+            f();
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+    assert(throws_runtime([&] { modinv(6, 9); }));
+    assert(throws_runtime([&] { modinv_batch({ 2, 3, 4 }, 9); }));
+    assert(throws_runtime([&] { modinv_batch({ 2, m, 4 }, m); }));
+    std::cout << "[PASS] modinv / modinv_batch\n";
+}
+
+static void bench() {
+    const BigInt m = generate_prime(2048);
+    std::vector<BigInt> values;
+    for (int i = 0; i < 200; ++i) values.push_back(random_bigint_bits(2047));
+
+    auto t0 = steady_clock::now();
+    for (const auto& v : values) modinv(v, m);
+    auto t1 = steady_clock::now();
+    modinv_batch(values, m);
+    auto t2 = steady_clock::now();
+    const double single = duration<double, std::micro>(t1 - t0).count() / values.size();
+    const double batch = duration<double, std::micro>(t2 - t1).count() / values.size();
+    std::cout << "[INFO] 2048-bit inverz: " << single << " us pojedinacno, " << batch << " us po elementu u seriji\n";
+}
+
+int main() {
+    try {
+        test_egcd();
+        test_modinv();
+        bench();
+        std::cout << "[ALL TESTS PASSED]\n";
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "[TEST FAILED] Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
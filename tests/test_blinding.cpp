@@ -0,0 +1,125 @@
+#include "rsa.hpp"
+#include "bigint_utils.hpp"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+
+using namespace CryptoLib;
+using namespace std::chrono;
+
+// Potpis je deterministički, pa blinding ne sme da promeni rezultat, ni posle mnogo
+// kvadriranja para ni preko granice obnavljanja
+static void test_matches_unblinded(const RSAKeyPair& kp) {
+    RSA::set_blinding(false);
+    std::vector<std::vector<std::uint8_t>> expected;
+    for (int i = 0; i < 100; ++i) expected.push_back(RSA::sign("poruka " + std::to_string(i), kp.private_key));
+
+    RSA::set_blinding(true);
+    for (int i = 0; i < 100; ++i) assert(RSA::sign("poruka " + std::to_string(i), kp.private_key) == expected[i]);
+
+    auto c = RSA::encrypt_string("tajna", kp.public_key);
+    for (int i = 0; i < 40; ++i) assert(RSA::decrypt_to_string(c, kp.private_key) == "tajna");
+    std::cout << "[PASS] blinded results match unblinded\n";
+}
+
+// Ključ bez javnog eksponenta (npr. učitan spolja) koristi sporiji put obnavljanja
+static void test_key_without_e(const RSAKeyPair& kp) {
+    const PrivateKey legacy{ kp.private_key.n, kp.private_key.d, 0 };
+    assert(legacy.e == 0);
+    for (int i = 0; i < 40; ++i) {
+        auto sig = RSA::sign("m" + std::to_string(i), legacy);
+        assert(RSA::verify("m" + std::to_string(i), sig, kp.public_key));
+    }
+    std::cout << "[PASS] key without public exponent\n";
+}
+
+// Više ključeva nego mesta u kešu po niti: parovi se izbacuju i prave iznova
+static void test_many_keys() {
+    std::vector<RSAKeyPair> keys;
+    for (int i = 0; i < 6; ++i) keys.push_back(RSA::generate_keys(1024));
+    for (int round = 0; round < 5; ++round) {
+        for (const auto& kp : keys) {
+            auto sig = RSA::sign("kljuc", kp.private_key);
+            assert(RSA::verify("kljuc", sig, kp.public_key));
+        }
+    }
+    std::cout << "[PASS] interleaved keys beyond cache size\n";
+}
+
+// e koji ne odgovara d se odbija umesto pogrešnog rezultata; posle brisanja keša ključ radi dalje
+static void test_mismatched_e_and_clear(const RSAKeyPair& kp) {
+    const PrivateKey wrong{ kp.private_key.n, kp.private_key.d, kp.private_key.e + 2 };
+    bool threw = false;
+    try {
+        RSA::sign("pogresan e", wrong);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw && "Expected exception for e that does not match d");
+
+    const auto expected = RSA::sign("posle brisanja", kp.private_key);
+    RSA::clear_blinding_cache();
+    assert(RSA::sign("posle brisanja", kp.private_key) == expected);
+    std::thread([&] {
+        RSA::sign("druga nit", kp.private_key);
+        RSA::clear_blinding_cache();
+    }).join();
+    assert(RSA::sign("posle brisanja", kp.private_key) == expected);
+    std::cout << "[PASS] mismatched e rejected, cache clear\n";
+}
+
+static void test_threads(const RSAKeyPair& kp) {
+    const auto expected = RSA::sign("deljeno", kp.private_key);
+    std::atomic<int> failures{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 50; ++i)
+                if (RSA::sign("deljeno", kp.private_key) != expected) ++failures;
+        });
+    }
+    for (auto& t : threads) t.join();
+    assert(failures == 0);
+    std::cout << "[PASS] shared key from 4 threads\n";
+}
+
+static void bench(const RSAKeyPair& kp) {
+    auto c = RSA::encrypt_string("x", kp.public_key);
+    auto time_us = [&] {
+        RSA::decrypt(c, kp.private_key); // zagrevanje (i prvi blinding par)
+        const int n = 200;
+        auto t0 = steady_clock::now();
+        for (int i = 0; i < n; ++i) RSA::decrypt(c, kp.private_key);
+        return duration_cast<microseconds>(steady_clock::now() - t0).count() / double(n);
+    };
+    RSA::set_blinding(false);
+    const double plain = time_us();
+    RSA::set_blinding(true);
+    const double blinded = time_us();
+    std::cout << "[INFO] RSA-2048 decrypt: " << plain << " us bez blinding-a, " << blinded
+              << " us sa blinding-om (+" << (blinded / plain - 1) * 100 << "%)\n";
+}
+
+int main() {
+    try {
+        assert(RSA::blinding_enabled());
+        auto kp = RSA::generate_keys(2048);
+        assert(kp.private_key.e == kp.public_key.e);
+        test_matches_unblinded(kp);
+        test_key_without_e(kp);
+        test_many_keys();
+        test_mismatched_e_and_clear(kp);
+        test_threads(kp);
+        bench(kp);
+        std::cout << "[ALL TESTS PASSED]\n";
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "[TEST FAILED] Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
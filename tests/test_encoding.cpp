@@ -0,0 +1,141 @@
+#include "encoding.hpp"
+#include "random_utils.hpp"
+#include <iostream>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <cassert>
+
+using namespace CryptoLib;
+using namespace std::chrono;
+
+static std::vector<CodecKernel> kernels() {
+    std::vector<CodecKernel> ks = { CodecKernel::Scalar };
+    if (codec_kernel_supported(CodecKernel::AVX2)) ks.push_back(CodecKernel::AVX2);
+    return ks;
+}
+
+template <class F>
+static bool throws_invalid(F f) {
+    try {
+        f();
+    } catch (const std::invalid_argument&) {
+        return true;
+    }
+    return false;
+}
+
+// RFC 4648, poglavlje 10
+static void test_vectors() {
+    const char* plain[] = { "", "f", "fo", "foo", "foob", "fooba", "foobar" };
+    const char* b64[] = { "", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy" };
+    const char* hex[] = { "", "66", "666f", "666f6f", "666f6f62", "666f6f6261", "666f6f626172" };
+    for (int i = 0; i < 7; ++i) {
+        const std::string p = plain[i];
+        const std::vector<std::uint8_t> bytes(p.begin(), p.end());
+        assert(base64_encode(bytes) == b64[i]);
+        assert(base64_decode(b64[i]) == bytes);
+        assert(hex_encode(bytes) == hex[i]);
+        assert(hex_decode(hex[i]) == bytes);
+    }
+    assert(hex_decode("DEADbeef") == (std::vector<std::uint8_t>{ 0xDE, 0xAD, 0xBE, 0xEF }));
+}
+
+// SIMD i skalarni put moraju da daju isto za sve dužine (granice blokova od 24/32/64)
+static void test_differential() {
+    for (std::size_t len = 0; len < 300; ++len) {
+        std::vector<std::uint8_t> data(len);
+        csprng_bytes(data);
+        set_codec_kernel(CodecKernel::Scalar);
+        const std::string h = hex_encode(data);
+        const std::string b = base64_encode(data);
+        for (CodecKernel k : kernels()) {
+            set_codec_kernel(k);
+            assert(hex_encode(data) == h);
+            assert(base64_encode(data) == b);
+            assert(hex_decode(h) == data);
+            assert(base64_decode(b) == data);
+        }
+    }
+    std::cout << "[PASS] differential scalar/SIMD\n";
+}
+
+static void test_strict_validation() {
+    for (CodecKernel k : kernels()) {
+        set_codec_kernel(k);
+        std::vector<std::uint8_t> data(200, 0xAB);
+        const std::string h = hex_encode(data);
+        const std::string b = base64_encode(data);
+
+        assert(throws_invalid([&] { hex_decode(h.substr(1)); }));     // neparna dužina
+        assert(throws_invalid([&] { base64_decode(b.substr(1)); }));  // dužina nije deljiva sa 4
+
+        // Neispravan znak na svakoj poziciji (i u SIMD blokovima i u repu)
+        for (std::size_t pos = 0; pos < h.size(); pos += 7) {
+            for (char bad : { 'g', 'G', ' ', '\n', '\x80', '\xff', '/' }) {
+                std::string t = h;
+                t[pos] = bad;
+                assert(throws_invalid([&] { hex_decode(t); }));
+            }
+        }
+        for (std::size_t pos = 0; pos < b.size(); pos += 5) {
+            for (char bad : { '=', '-', '_', ' ', '\n', '\x80', '.' }) {
+                std::string t = b;
+                t[pos] = bad;
+                if (bad == '=' && pos + 1 == b.size()) continue; // ovo je ispravan padding za ovu dužinu
+                assert(throws_invalid([&] { base64_decode(t); }));
+            }
+        }
+
+        // Padding: samo na kraju, nenulti bitovi se odbijaju
+        assert(throws_invalid([&] { base64_decode("Zg=a"); }));
+        assert(throws_invalid([&] { base64_decode("Z==="); }));
+        assert(throws_invalid([&] { base64_decode("Zg==Zg=="); }));
+        assert(throws_invalid([&] { base64_decode("Zh=="); }));
+        assert(throws_invalid([&] { base64_decode("Zm9="); }));
+    }
+    std::cout << "[PASS] strict validation\n";
+}
+
+static void bench() {
+    std::vector<std::uint8_t> data(32 << 20);
+    csprng_bytes(data);
+    std::string text(base64_encoded_size(data.size()), '\0');
+    std::vector<std::uint8_t> back(data.size());
+
+    for (CodecKernel k : kernels()) {
+        set_codec_kernel(k);
+        auto mbps = [&](auto f) {
+            auto t0 = steady_clock::now();
+            f();
+            return data.size() / duration<double>(steady_clock::now() - t0).count() / (1 << 20);
+        };
+        std::string hex(hex_encoded_size(data.size()), '\0');
+        const double he = mbps([&] { hex_encode(data.data(), data.size(), &hex[0]); });
+        const double hd = mbps([&] { hex_decode(hex.data(), hex.size(), back.data()); });
+        assert(back == data);
+        const double be = mbps([&] { base64_encode(data.data(), data.size(), &text[0]); });
+        const double bd = mbps([&] { base64_decode(text.data(), text.size(), back.data()); });
+        assert(back == data);
+        std::cout << "[INFO] " << codec_kernel_name(k) << ": hex enc " << he << " MiB/s, dec " << hd
+                  << " MiB/s; base64 enc " << be << " MiB/s, dec " << bd << " MiB/s\n";
+    }
+}
+
+int main() {
+    try {
+        const CodecKernel initial = get_codec_kernel();
+        std::cout << "[INFO] codec kernel: " << codec_kernel_name(initial) << "\n";
+        test_vectors();
+        std::cout << "[PASS] RFC 4648 vectors\n";
+        test_differential();
+        test_strict_validation();
+        bench();
+        set_codec_kernel(initial);
+        std::cout << "[ALL TESTS PASSED]\n";
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "[TEST FAILED] Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,136 @@
+#include "hash_utils.hpp"
+#include "oaep.hpp"
+#include "rsa.hpp"
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <cassert>
+#include <algorithm>
+
+using namespace CryptoLib;
+using namespace std::chrono;
+
+static std::string hex(const std::vector<std::uint8_t>& v) {
+    static const char* digits = "0123456789abcdef";
+    std::string s;
+    for (auto b : v) { s += digits[b >> 4]; s += digits[b & 0xF]; }
+    return s;
+}
+
+// FIPS 180-4 primeri ("abc" i prazna poruka)
+static void test_known_answers() {
+    const std::vector<std::uint8_t> abc = { 'a', 'b', 'c' };
+    assert(hex(sha256(abc)) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    assert(hex(sha384(abc)) == "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded163"
+                               "1a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7");
+    assert(hex(sha512(abc)) == "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+                               "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f");
+    assert(hex(sha512({})) == "cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce"
+                              "47d0d13c5d85f2b0ff8318d2877eec2f63b931bd47417a81a538327af927da3e");
+    assert(Sha384::hash(abc).size() == Sha384::digest_size);
+    std::cout << "[PASS] SHA-256/384/512 known answers\n";
+}
+
+// MGF1(seed, len) = prvih len bajtova od H(seed || 0) || H(seed || 1) || ...
+template <class Hash>
+static void test_mgf1() {
+    const std::vector<std::uint8_t> seed = { 1, 2, 3, 4, 5 };
+    std::vector<std::uint8_t> expected;
+    for (std::uint8_t c = 0; c < 4; ++c) {
+        std::vector<std::uint8_t> in = seed;
+        in.insert(in.end(), { 0, 0, 0, c });
+        auto h = Hash::hash(in);
+        expected.insert(expected.end(), h.begin(), h.end());
+    }
+    const std::size_t len = 3 * Hash::digest_size + 7;
+    expected.resize(len);
+    assert(mgf1<Hash>(seed, len) == expected);
+}
+
+// Inkrementalno heširanje u delovima proizvoljnih dužina mora dati isto što i jednokratno
+template <class Hash>
+static void test_incremental() {
+    std::vector<std::uint8_t> data(3 * Hash::block_size * 7 + 5);
+    for (std::size_t i = 0; i < data.size(); ++i) data[i] = static_cast<std::uint8_t>(i * 13 + 1);
+
+    HashContext<Hash> ctx;
+    for (std::size_t step : { std::size_t(1), std::size_t(7), Hash::block_size, data.size() }) {
+        for (std::size_t off = 0; off < data.size(); off += step)
+            ctx.update(data.data() + off, std::min(step, data.size() - off));
+        assert(ctx.finish() == Hash::hash(data)); // finish() resetuje kontekst
+    }
+    assert(ctx.finish() == Hash::hash({}));
+
+    // assign(): zajednički prefiks se hešira jednom, izvor ostaje nepromenjen
+    HashContext<Hash> prefix, work;
+    prefix.update(data.data(), Hash::block_size + 3);
+    for (int i = 0; i < 3; ++i) {
+        work.assign(prefix);
+        work.update(data.data() + Hash::block_size + 3, data.size() - Hash::block_size - 3);
+        assert(work.finish() == Hash::hash(data));
+    }
+    work.assign(prefix);
+    assert(work.finish() == prefix.finish());
+}
+
+template <class Hash>
+static void test_oaep(const RSAKeyPair& kp, std::size_t k) {
+    const std::size_t max_len = k - 2 * Hash::digest_size - 2;
+    const std::string msg(max_len, 'x');
+    auto c = RSA::encrypt_string<Hash>(msg, kp.public_key);
+    assert(RSA::decrypt_to_string<Hash>(c, kp.private_key) == msg);
+
+    bool threw = false;
+    try {
+        RSA::encrypt_string<Hash>(msg + "y", kp.public_key);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw && "Expected message too long");
+
+    auto sig = RSA::sign<Hash>("poruka", kp.private_key);
+    assert(RSA::verify<Hash>("poruka", sig, kp.public_key));
+    assert(!RSA::verify<Hash>("Poruka", sig, kp.public_key));
+}
+
+static void bench_hash() {
+    const std::vector<std::uint8_t> data(16 << 20, 0x5A);
+    auto time = [&](std::vector<std::uint8_t> (*f)(const std::vector<std::uint8_t>&)) {
+        auto t0 = steady_clock::now();
+        f(data);
+        return data.size() / duration<double>(steady_clock::now() - t0).count() / (1 << 20);
+    };
+    std::cout << "[INFO] 16 MiB: SHA-256 " << time(sha256) << " MiB/s, SHA-512 " << time(sha512) << " MiB/s\n";
+}
+
+int main() {
+    try {
+        test_known_answers();
+        test_mgf1<Sha256>();
+        test_mgf1<Sha384>();
+        test_mgf1<Sha512>();
+        std::cout << "[PASS] MGF1\n";
+
+        test_incremental<Sha256>();
+        test_incremental<Sha384>();
+        test_incremental<Sha512>();
+        std::cout << "[PASS] HashContext\n";
+
+        auto kp = RSA::generate_keys(2048);
+        test_oaep<Sha256>(kp, 256);
+        test_oaep<Sha384>(kp, 256);
+        test_oaep<Sha512>(kp, 256);
+        // OAEP sa SHA-256 mora ostati kompatibilan sa dosadašnjim API-jem
+        auto c = RSA::encrypt_string("stari API", kp.public_key);
+        assert(RSA::decrypt_to_string<Sha256>(c, kp.private_key) == "stari API");
+        assert(RSA::verify<Sha256>("m", RSA::sign("m", kp.private_key), kp.public_key));
+        std::cout << "[PASS] OAEP / potpis sa SHA-256, SHA-384, SHA-512\n";
+
+        bench_hash();
+        std::cout << "[ALL TESTS PASSED]\n";
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "[TEST FAILED] Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,160 @@
+#include "hmac.hpp"
+#include "hash_utils.hpp"
+#include "encoding.hpp"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cassert>
+
+using namespace CryptoLib;
+using namespace std::chrono;
+
+static std::vector<std::uint8_t> bytes(const std::string& s) {
+    return std::vector<std::uint8_t>(s.begin(), s.end());
+}
+
+// RFC 4231, test slučajevi 1, 2, 3 i 6 (ključ duži od bloka)
+static void test_rfc4231() {
+    const std::vector<std::uint8_t> long_key(131, 0xaa);
+    const auto long_msg = bytes("Test Using Larger Than Block-Size Key - Hash Key First");
+
+    assert(hex_encode(hmac_sha256(std::vector<std::uint8_t>(20, 0x0b), bytes("Hi There"))) ==
+           "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7");
+    assert(hex_encode(hmac_sha256(bytes("Jefe"), bytes("what do ya want for nothing?"))) ==
+           "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+    assert(hex_encode(hmac_sha256(std::vector<std::uint8_t>(20, 0xaa), std::vector<std::uint8_t>(50, 0xdd))) ==
+           "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe");
+    assert(hex_encode(hmac_sha256(long_key, long_msg)) ==
+           "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54");
+
+    assert(hex_encode(Hmac<Sha384>(bytes("Jefe")).mac(bytes("what do ya want for nothing?"))) ==
+           "af45d2e376484031617f78d2b58a6b1b9c7ef464f5a01b47e42ec3736322445e"
+           "8e2240ca5e69e2c78b3239ecfab21649");
+    assert(hex_encode(Hmac<Sha512>(long_key).mac(long_msg)) ==
+           "80b24263c7c1a3ebb71493c1dd7be8b49b46d1f41b4aeec1121b013783f8f352"
+           "6b56d037e05f2598bd0fd2215d6a1e5295e64f73f63f0aec8b915a985d786598");
+    std::cout << "[PASS] HMAC RFC 4231\n";
+}
+
+// Pripremljen ključ daje isti rezultat za svaku poruku, bez obzira na redosled i druge ključeve
+static void test_prepared() {
+    const HmacSha256 a(bytes("kljuc A")), b(bytes("kljuc B"));
+    std::vector<std::vector<std::uint8_t>> messages;
+    for (std::size_t len : { 0, 1, 55, 56, 63, 64, 65, 1000 }) messages.push_back(std::vector<std::uint8_t>(len, 0x42));
+
+    for (const auto& m : messages) {
+        const auto ta = a.mac(m);
+        assert(b.mac(m) != ta);
+        assert(a.mac(m) == ta && ta == hmac_sha256(bytes("kljuc A"), m));
+        assert(a.verify(m, ta));
+        auto bad = ta;
+        bad[31] ^= 1;
+        assert(!a.verify(m, bad) && !a.verify(m, std::vector<std::uint8_t>(ta.begin(), ta.end() - 1)));
+    }
+
+    const auto tags = a.mac_batch(messages);
+    std::vector<std::uint8_t> flat(messages.size() * HmacSha256::tag_size);
+    a.mac_batch(messages, flat.data());
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        assert(tags[i] == a.mac(messages[i]));
+        assert(std::equal(tags[i].begin(), tags[i].end(), flat.begin() + i * HmacSha256::tag_size));
+    }
+
+    // Deljen objekat iz više niti
+    std::atomic<int> failures{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 200; ++i)
+                if (a.mac_batch(messages) != tags) ++failures;
+        });
+    }
+    for (auto& t : threads) t.join();
+    assert(failures == 0);
+    std::cout << "[PASS] prepared key, verify, batch, threads\n";
+}
+
+// RFC 5869, test slučajevi 1 i 3
+static void test_hkdf() {
+    std::vector<std::uint8_t> salt, info;
+    for (int i = 0; i <= 0x0c; ++i) salt.push_back(static_cast<std::uint8_t>(i));
+    for (int i = 0xf0; i <= 0xf9; ++i) info.push_back(static_cast<std::uint8_t>(i));
+    const std::vector<std::uint8_t> ikm(22, 0x0b);
+
+    assert(hex_encode(hkdf_extract<Sha256>(salt, ikm)) ==
+           "077709362c2e32df0ddc3f0dc47bba6390b6c73bb50f9c3122ec844ad7c2b3e5");
+    assert(hex_encode(hkdf_sha256(salt, ikm, info, 42)) ==
+           "3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf34007208d5b887185865");
+    assert(hex_encode(hkdf_extract<Sha256>({}, ikm)) ==
+           "19ef24a32c717b167f33a91d6f648bdf96596776afdb6377ac434c1c293ccb04");
+    assert(hex_encode(hkdf_sha256({}, ikm, {}, 42)) ==
+           "8da4e775a563c18f715f802a063c5a31b8a11f5c5ee1879ec3454e5f3c738d2d9d201395faa4b61a96c8");
+
+    // Kraći izlaz je prefiks dužeg; granica 255 blokova
+    const auto prk = hkdf_extract<Sha256>(salt, ikm);
+    const auto full = hkdf_expand<Sha256>(prk, info, 255 * 32);
+    assert(hkdf_expand<Sha256>(prk, info, 33) == std::vector<std::uint8_t>(full.begin(), full.begin() + 33));
+    assert(hkdf_expand<Sha256>(prk, info, 0).empty());
+    bool threw = false;
+    try {
+        hkdf_expand<Sha256>(prk, info, 255 * 32 + 1);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw && "Expected exception for length > 255 * HashLen");
+    assert(hkdf<Sha512>(salt, ikm, info, 100).size() == 100);
+    std::cout << "[PASS] HKDF RFC 5869\n";
+}
+
+// HMAC bez međustanja: ipad/opad blokovi se heširaju za svaku poruku
+static std::vector<std::uint8_t> hmac_naive(const std::vector<std::uint8_t>& key, const std::vector<std::uint8_t>& m) {
+    std::vector<std::uint8_t> ipad(Sha256::block_size, 0x36), opad(Sha256::block_size, 0x5c);
+    for (std::size_t i = 0; i < key.size(); ++i) {
+        ipad[i] ^= key[i];
+        opad[i] ^= key[i];
+    }
+    HashContext<Sha256> ctx;
+    ctx.update(ipad);
+    ctx.update(m);
+    const auto inner = ctx.finish();
+    ctx.update(opad);
+    ctx.update(inner);
+    return ctx.finish();
+}
+
+static void bench() {
+    const auto key = bytes("kljuc za zapise");
+    std::vector<std::vector<std::uint8_t>> records(100000, std::vector<std::uint8_t>(48, 0x17));
+    assert(hmac_naive(key, records[0]) == hmac_sha256(key, records[0]));
+
+    auto t0 = steady_clock::now();
+    for (const auto& r : records) hmac_naive(key, r);
+    auto t1 = steady_clock::now();
+    const HmacSha256 hmac(key);
+    std::vector<std::uint8_t> tags(records.size() * HmacSha256::tag_size);
+    hmac.mac_batch(records, tags.data());
+    auto t2 = steady_clock::now();
+
+    const double naive = duration<double, std::nano>(t1 - t0).count() / records.size();
+    const double prepared = duration<double, std::nano>(t2 - t1).count() / records.size();
+    std::cout << "[INFO] HMAC-SHA-256, 48-bajtni zapisi: " << naive << " ns bez medjustanja, " << prepared
+              << " ns sa pripremljenim kljucem (x" << naive / prepared << ")\n";
+}
+
+int main() {
+    try {
+        test_rfc4231();
+        test_prepared();
+        test_hkdf();
+        bench();
+        std::cout << "[ALL TESTS PASSED]\n";
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "[TEST FAILED] Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
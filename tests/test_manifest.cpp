@@ -0,0 +1,159 @@
+#include "manifest.hpp"
+#include "hash_utils.hpp"
+#include "rsa.hpp"
+#include <iostream>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <algorithm>
+#include <cassert>
+
+using namespace CryptoLib;
+using namespace std::chrono;
+namespace fs = std::filesystem;
+
+static void write_bytes(const fs::path& p, const std::vector<std::uint8_t>& data) {
+    fs::create_directories(p.parent_path());
+    std::ofstream ofs(p, std::ios::binary);
+    ofs.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+static std::vector<std::uint8_t> pattern(std::size_t len, std::uint8_t seed) {
+    std::vector<std::uint8_t> v(len);
+    for (std::size_t i = 0; i < len; ++i) v[i] = static_cast<std::uint8_t>(i * 31 + seed);
+    return v;
+}
+
+template <class F>
+static bool throws_invalid(F f) {
+    try {
+        f();
+    } catch (const std::invalid_argument&) {
+        return true;
+    }
+    return false;
+}
+
+// Prazan fajl, fajl veći od bloka čitanja, razmaci u imenu, ugnežđeni direktorijumi
+static void make_tree(const fs::path& root) {
+    fs::remove_all(root);
+    write_bytes(root / "a.txt", { 'a', 'b', 'c' });
+    write_bytes(root / "empty.bin", {});
+    write_bytes(root / "sub dir" / "big.bin", pattern((3 << 20) + 17, 5));
+    write_bytes(root / "sub dir" / "deeper" / "x y.txt", pattern(100, 9));
+    for (int i = 0; i < 50; ++i) write_bytes(root / "many" / ("f" + std::to_string(i)), pattern(i * 7, static_cast<std::uint8_t>(i)));
+}
+
+static void test_build(const fs::path& root) {
+    auto entries = build_manifest(root.string(), 4);
+    assert(entries.size() == 54);
+    assert(std::is_sorted(entries.begin(), entries.end(),
+                          [](const ManifestEntry& a, const ManifestEntry& b) { return a.path < b.path; }));
+    assert(entries[0].path == "a.txt" && entries[0].size == 3);
+    assert(entries[0].digest == sha256({ 'a', 'b', 'c' }));
+    for (const auto& e : entries) {
+        if (e.path == "sub dir/big.bin") {
+            assert(e.size == (3u << 20) + 17);
+            assert(e.digest == sha256(pattern((3 << 20) + 17, 5)));
+        }
+        if (e.path == "empty.bin") assert(e.digest == sha256({}));
+    }
+
+    // Rezultat ne zavisi od broja niti; serijalizacija je reverzibilna
+    const std::string text = serialize_manifest(entries);
+    assert(serialize_manifest(build_manifest(root.string(), 1)) == text);
+    const auto parsed = parse_manifest(text);
+    assert(serialize_manifest(parsed) == text);
+    std::cout << "[PASS] build/serialize/parse manifest\n";
+}
+
+static void test_parse_rejects() {
+    const std::string header = "CryptoLib-Manifest v1 sha256\n";
+    const std::string d(64, 'a');
+    assert(parse_manifest(header).empty());
+    assert(throws_invalid([&] { parse_manifest(""); }));
+    assert(throws_invalid([&] { parse_manifest("CryptoLib-Manifest v2 sha256\n"); }));
+    assert(throws_invalid([&] { parse_manifest(header + "3 " + d + " a"); }));                // bez novog reda
+    assert(throws_invalid([&] { parse_manifest(header + "x " + d + " a\n"); }));              // veličina
+    assert(throws_invalid([&] { parse_manifest(header + "99999999999999999999 " + d + " a\n"); }));
+    assert(throws_invalid([&] { parse_manifest(header + "3 " + d.substr(1) + " a\n"); }));    // digest
+    assert(throws_invalid([&] { parse_manifest(header + "3 " + std::string(64, 'g') + " a\n"); }));
+    assert(throws_invalid([&] { parse_manifest(header + "3 " + d + " \n"); }));               // prazna putanja
+    assert(throws_invalid([&] { parse_manifest(header + "3 " + d + " b\n3 " + d + " a\n"); })); // nesortirano
+    assert(throws_invalid([&] { parse_manifest(header + "3 " + d + " a\n3 " + d + " a\n"); })); // duplikat
+    std::cout << "[PASS] parse rejects malformed manifests\n";
+}
+
+static void test_sign_verify(const fs::path& root, const RSAKeyPair& kp) {
+    SignedManifest m = sign_directory(root.string(), kp.private_key);
+    ManifestReport r = verify_directory(root.string(), m, kp.public_key);
+    assert(r.ok());
+
+    // Izmena, brisanje i novi fajl se prijavljuju pojedinačno
+    write_bytes(root / "sub dir" / "deeper" / "x y.txt", pattern(100, 10));
+    fs::remove(root / "many" / "f3");
+    write_bytes(root / "new.txt", { 'n' });
+    r = verify_directory(root.string(), m, kp.public_key, 3);
+    assert(r.signature_ok && !r.ok());
+    assert(r.modified == std::vector<std::string>{ "sub dir/deeper/x y.txt" });
+    assert(r.missing == std::vector<std::string>{ "many/f3" });
+    assert(r.added == std::vector<std::string>{ "new.txt" });
+
+    // Ista veličina, drugačiji sadržaj
+    make_tree(root);
+    write_bytes(root / "a.txt", { 'a', 'b', 'd' });
+    r = verify_directory(root.string(), m, kp.public_key);
+    assert(r.modified == std::vector<std::string>{ "a.txt" } && r.missing.empty() && r.added.empty());
+
+    // Izmenjen manifest ili pogrešan ključ -> potpis ne prolazi i sadržaju se ne veruje
+    make_tree(root);
+    SignedManifest forged = m;
+    forged.text[forged.text.find("3 ") + 2] ^= 0x01;
+    r = verify_directory(root.string(), forged, kp.public_key);
+    assert(!r.signature_ok && !r.ok() && r.modified.empty());
+    assert(verify_directory(root.string(), m, kp.public_key).ok());
+    std::cout << "[PASS] sign/verify directory, mismatches reported\n";
+}
+
+// Jedna privatna operacija po stablu, bez obzira na broj fajlova
+static void bench(const fs::path& root, const RSAKeyPair& kp) {
+    fs::remove_all(root);
+    const int files = 2000;
+    for (int i = 0; i < files; ++i)
+        write_bytes(root / std::to_string(i % 20) / ("file" + std::to_string(i)), pattern(4096, static_cast<std::uint8_t>(i)));
+
+    auto t0 = steady_clock::now();
+    SignedManifest m = sign_directory(root.string(), kp.private_key);
+    auto t1 = steady_clock::now();
+    assert(verify_directory(root.string(), m, kp.public_key).ok());
+    auto t2 = steady_clock::now();
+
+    auto t3 = steady_clock::now();
+    RSA::sign("x", kp.private_key);
+    auto t4 = steady_clock::now();
+    std::cout << "[INFO] " << files << " fajlova: potpis manifesta " << duration_cast<milliseconds>(t1 - t0).count()
+              << " ms, verifikacija " << duration_cast<milliseconds>(t2 - t1).count()
+              << " ms (jedan RSA potpis: " << duration_cast<microseconds>(t4 - t3).count() / 1000.0 << " ms)\n";
+}
+
+int main() {
+    const fs::path root = fs::temp_directory_path() / "cryptolib_test_manifest";
+    try {
+        make_tree(root);
+        test_build(root);
+        test_parse_rejects();
+
+        auto kp = RSA::generate_keys(2048);
+        test_sign_verify(root, kp);
+        bench(root, kp);
+
+        fs::remove_all(root);
+        std::cout << "[ALL TESTS PASSED]\n";
+        return 0;
+    } catch (const std::exception& ex) {
+        fs::remove_all(root);
+        std::cerr << "[TEST FAILED] Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,145 @@
+#include "montgomery.hpp"
+#include "bigint_utils.hpp"
+#include "prime_utils.hpp"
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cassert>
+
+using namespace CryptoLib;
+
+// Referenca: postojeći modexp bez Montgomery puta (Barrett / deljenje)
+static BigInt reference_modexp(const BigInt& base, const BigInt& exp, const BigInt& mod) {
+    const MontKernel saved = get_mont_kernel();
+    set_mont_kernel(MontKernel::None);
+    BigInt r = modexp(base, exp, mod);
+    set_mont_kernel(saved);
+    return r;
+}
+
+static void test_kernel(MontKernel kernel) {
+    if (!mont_kernel_supported(kernel)) {
+        std::cout << "[SKIP] kernel=" << mont_kernel_name(kernel) << " nije podrzan na ovom CPU-u\n";
+        return;
+    }
+
+    std::vector<int> sizes = { 1024, 1536, 2048 };
+    for (int bits = 61; bits < 4096; bits = bits * 5 / 3 + 7) sizes.push_back(bits);
+    sizes.push_back(4096);
+
+    for (int bits : sizes) {
+        for (int r = 0; r < 3; ++r) {
+            BigInt m = random_bigint_bits(bits); // neparan, tačno bits bitova
+            BigInt base = random_bigint_bits(bits + 17);
+            BigInt exp = random_bigint_bits(r == 0 ? 17 : bits);
+            assert(mont_modexp(base, exp, m, kernel) == reference_modexp(base, exp, m));
+        }
+
+        // Granični slučajevi
+        BigInt m = random_bigint_bits(bits);
+        BigInt e = random_bigint_bits(bits);
+        assert(mont_modexp(0, e, m, kernel) == 0);
+        assert(mont_modexp(m - 1, 2, m, kernel) == 1);
+        assert(mont_modexp(m - 1, e, m, kernel) == reference_modexp(m - 1, e, m));
+        assert(mont_modexp(m, e, m, kernel) == 0);
+        assert(mont_modexp(12345, 0, m, kernel) == 1);
+        assert(mont_modexp(12345, 1, m, kernel) == 12345 % m);
+    }
+
+    // modexp mora da koristi izabrani kernel i da daje isti rezultat
+    set_mont_kernel(kernel);
+    BigInt m = random_bigint_bits(2048);
+    BigInt base = random_bigint_bits(2047);
+    BigInt e = random_bigint_bits(2048);
+    assert(modexp(base, e, m) == reference_modexp(base, e, m));
+    set_mont_kernel(detect_mont_kernel());
+
+    std::cout << "[PASS] kernel=" << mont_kernel_name(kernel) << "\n";
+}
+
+// Multi-buffer: različiti moduli i dužine eksponenata u istoj grupi, nepun poslednji prolaz,
+// ulazi koje kernel ne pokriva (paran modul, prevelik modul) idu pojedinačno
+static void test_batch(MontKernel kernel) {
+    if (!mont_kernel_supported(kernel)) return;
+    set_mont_kernel(kernel);
+    const std::size_t lanes = mont_batch_lanes();
+
+    for (int bits : { 61, 521, 1024, 2048, 4096 }) {
+        std::vector<BigInt> bases, exps, mods;
+        for (std::size_t i = 0; i < 2 * lanes + 3; ++i) {
+            mods.push_back(random_bigint_bits(bits - static_cast<int>(i % 3) * 7));
+            bases.push_back(i == 1 ? BigInt(0) : random_bigint_bits(bits + 9));
+            exps.push_back(i == 2 ? BigInt(0) : random_bigint_bits(i % 2 ? bits : 17));
+        }
+        auto r = mont_modexp_batch(bases, exps, mods);
+        assert(r.size() == bases.size());
+        for (std::size_t i = 0; i < r.size(); ++i) assert(r[i] == reference_modexp(bases[i], exps[i], mods[i]));
+
+        // Zajednički eksponent i modul (Miller-Rabin, serija istim ključem)
+        const std::vector<BigInt> e1{ exps[3] }, m1{ mods[0] };
+        r = mont_modexp_batch(bases, e1, m1);
+        for (std::size_t i = 0; i < r.size(); ++i) assert(r[i] == reference_modexp(bases[i], e1[0], m1[0]));
+    }
+
+    std::vector<BigInt> bases{ 3, 3, 7 }, exps{ 5, 5, 3 }, mods{ 101, 100, random_bigint_bits(9000) };
+    bool threw = false;
+    try {
+        mont_modexp_batch(bases, exps, mods);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw && "Expected exception for even modulus");
+    auto r = modexp_batch(bases, exps, mods);
+    assert(r[0] == 41 && r[1] == 43 && r[2] == 343);
+    assert(mont_modexp_batch({}, { 1 }, { 3 }).empty());
+
+    set_mont_kernel(detect_mont_kernel());
+    std::cout << "[PASS] batch kernel=" << mont_kernel_name(kernel) << " lanes=" << lanes << "\n";
+}
+
+static void bench_batch() {
+    const int count = 32;
+    std::vector<BigInt> bases;
+    for (int i = 0; i < count; ++i) bases.push_back(random_bigint_bits(2047));
+    const std::vector<BigInt> exps{ random_bigint_bits(2048) }, mods{ random_bigint_bits(2048) };
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (const auto& b : bases) mont_modexp(b, exps[0], mods[0]);
+    auto t1 = std::chrono::steady_clock::now();
+    mont_modexp_batch(bases, exps, mods);
+    auto t2 = std::chrono::steady_clock::now();
+    const double single = std::chrono::duration<double, std::micro>(t1 - t0).count() / count;
+    const double batch = std::chrono::duration<double, std::micro>(t2 - t1).count() / count;
+    std::cout << "[INFO] 2048-bit modexp: " << single << " us pojedinacno, " << batch << " us u seriji ("
+              << mont_batch_lanes() << " traka, x" << single / batch << ")\n";
+}
+
+int main() {
+    try {
+        std::cout << "[INFO] Detektovan kernel: " << mont_kernel_name(detect_mont_kernel()) << "\n";
+        test_kernel(MontKernel::Scalar);
+        test_kernel(MontKernel::AVX2);
+        test_kernel(MontKernel::IFMA);
+
+        // Paran modul ne sme na Montgomery
+        bool threw = false;
+        try {
+            mont_modexp(3, 5, 100, MontKernel::Scalar);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw && "Expected exception for even modulus");
+        assert(modexp(3, 5, 100) == 43);
+
+        test_batch(MontKernel::Scalar);
+        test_batch(MontKernel::AVX2);
+        test_batch(MontKernel::IFMA);
+        bench_batch();
+
+        std::cout << "[ALL TESTS PASSED]\n";
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "[TEST FAILED] Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,81 @@
+#include "mul_utils.hpp"
+#include "bigint_utils.hpp"
+#include "prime_utils.hpp"
+#include "montgomery.hpp"
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+using namespace CryptoLib;
+
+// Karatsuba množenje/kvadriranje mora dati isto što i cpp_int, za razne pragove
+static void test_mul_sqr(std::size_t threshold) {
+    MulThresholds t = get_mul_thresholds();
+    t.karatsuba_mul = threshold;
+    t.karatsuba_sqr = threshold;
+    set_mul_thresholds(t);
+
+    // Fiksni (native) backend: proizvod mora da stane u bigint_max_bits
+    const int max_bits = bigint_max_bits != 0 ? static_cast<int>(bigint_max_bits / 2) - 1 : 16384;
+    for (int bits = 64; bits <= max_bits; bits = bits * 3 / 2 + 37) {
+        BigInt a = random_bigint_bits(bits);
+        BigInt b = random_bigint_bits(bits);
+        BigInt c = random_bigint_bits(bits / 2 + 1);
+        assert(mul(a, b) == a * b);
+        assert(mul(a, c) == a * c);
+        assert(sqr(a) == a * a);
+
+        // Granični slučaj: svi bitovi postavljeni (maksimalni prenosi)
+        BigInt ones = (BigInt(1) << bits) - 1;
+        assert(mul(ones, ones) == ones * ones);
+        assert(sqr(ones) == ones * ones);
+    }
+    assert(mul(0, random_bigint_bits(4096)) == 0);
+    assert(sqr(0) == 0);
+    std::cout << "[PASS] mul/sqr threshold=" << threshold << "\n";
+}
+
+// Barrett redukcija i modexp preko Barrett-a moraju se slagati sa deljenjem
+static void test_barrett_modexp() {
+    const MulThresholds defaults;
+    set_mont_kernel(MontKernel::None); // neparni moduli bi inače išli na Montgomery
+    for (int bits : { 512, 1024, 2048, 3072, 4096, 8192 }) {
+        BigInt m = random_bigint_bits(bits);
+        BigInt a = random_bigint_bits(bits - 1);
+        BigInt b = random_bigint_bits(bits - 3);
+
+        BarrettReducer red(m);
+        BigInt x = a * b;
+        assert(red.reduce(x) == x % m);
+        assert(red.reduce(m - 1) == m - 1);
+        assert(red.reduce(m) == 0);
+
+        BigInt e = random_bigint_bits(bits >= 4096 ? 256 : bits);
+        MulThresholds t = defaults;
+        t.barrett = static_cast<std::size_t>(1) << 20; // isključi Barrett
+        set_mul_thresholds(t);
+        BigInt expected = modexp(a, e, m);
+        t.barrett = 1;
+        set_mul_thresholds(t);
+        assert(modexp(a, e, m) == expected);
+
+        std::cout << "[PASS] Barrett modexp bits=" << bits << "\n";
+    }
+    set_mul_thresholds(defaults);
+    set_mont_kernel(detect_mont_kernel());
+}
+
+int main() {
+    try {
+        for (std::size_t threshold : { 8, 13, 32, 48 }) {
+            test_mul_sqr(threshold);
+        }
+        set_mul_thresholds(MulThresholds{});
+        test_barrett_modexp();
+        std::cout << "[ALL TESTS PASSED]\n";
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "[TEST FAILED] Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
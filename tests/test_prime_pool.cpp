@@ -0,0 +1,130 @@
+#include "prime_pool.hpp"
+#include "prime_utils.hpp"
+#include "rsa.hpp"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <cstdio>
+#include <cassert>
+
+using namespace CryptoLib;
+using namespace std::chrono;
+
+// Čeka da pozadinske niti napune pool (najviše ~60 s)
+static bool wait_for_stock(const PrimePool& pool, int bits, std::size_t count) {
+    for (int i = 0; i < 600; ++i) {
+        if (pool.stats(bits).available >= count) return true;
+        std::this_thread::sleep_for(milliseconds(100));
+    }
+    return false;
+}
+
+static void test_refill_and_take() {
+    PrimePoolConfig cfg;
+    cfg.prime_bits = { 256, 512 };
+    cfg.low_watermark = 2;
+    cfg.high_watermark = 4;
+    cfg.threads = 2;
+    PrimePool pool(cfg);
+
+    assert(wait_for_stock(pool, 256, 4));
+    assert(wait_for_stock(pool, 512, 4));
+    assert(pool.stats(256).available == 4); // ne puni preko high_watermark
+
+    BigInt p;
+    assert(pool.try_take(256, p));
+    assert(msb(p) + 1 == 256 && is_probable_prime(p));
+    assert(!pool.try_take(384, p)); // veličina koja nije podešena
+
+    // Posle pada ispod low_watermark pool se ponovo puni do high_watermark. Fiksan broj
+    // take() poziva bi se trkao sa nitima (dopuna može da završi između dva poziva i ostavi
+    // pool iznad low_watermark), pa se pool prazni dok try_take ne vrati false.
+    std::uint64_t taken = 1;
+    while (pool.try_take(256, p)) ++taken;
+    assert(wait_for_stock(pool, 256, 4));
+    assert(pool.stats(256).available == 4);
+
+    auto s = pool.stats(256);
+    assert(s.hits == taken && s.misses == 1); // promašaj je poslednji try_take
+    assert(s.generated >= 8);
+    std::cout << "[PASS] refill + take\n";
+}
+
+static void test_generate_keys_uses_pool() {
+    PrimePoolConfig cfg;
+    cfg.prime_bits = { 512 };
+    cfg.low_watermark = 2;
+    cfg.high_watermark = 4;
+    auto pool = std::make_shared<PrimePool>(cfg);
+    assert(wait_for_stock(*pool, 512, 4));
+
+    set_prime_pool(pool);
+    auto t1 = high_resolution_clock::now();
+    auto keys = RSA::generate_keys(1024);
+    auto t2 = high_resolution_clock::now();
+    set_prime_pool(nullptr);
+
+    assert(pool->stats(512).hits >= 2);
+    auto enc = RSA::encrypt_string("pool", keys.public_key);
+    assert(RSA::decrypt_to_string(enc, keys.private_key) == "pool");
+    std::cout << "[PASS] generate_keys iz pool-a: "
+              << duration_cast<microseconds>(t2 - t1).count() << " us\n";
+}
+
+static void test_persistence() {
+    const std::string path = "test_prime_pool.bin";
+    std::remove(path.c_str());
+
+    PrimePoolConfig cfg;
+    cfg.prime_bits = { 256 };
+    cfg.low_watermark = 1;
+    cfg.high_watermark = 3;
+    cfg.persist_path = path;
+    cfg.persist_key.assign(32, 0x42);
+
+    BigInt first;
+    {
+        PrimePool pool(cfg);
+        assert(wait_for_stock(pool, 256, 3));
+    } // destruktor čuva stanje
+
+    {
+        PrimePoolConfig cfg2 = cfg;
+        cfg2.threads = 0; // bez dopune, samo učitano stanje
+        PrimePool pool(cfg2);
+        assert(pool.stats(256).loaded == 3);
+        assert(pool.try_take(256, first) && is_probable_prime(first));
+        std::ifstream gone(path);
+        assert(!gone && "Persisted pool must be removed on load");
+        pool.stop(); // čuva preostala 2
+    }
+
+    {
+        PrimePoolConfig wrong = cfg;
+        wrong.threads = 0;
+        wrong.persist_key.assign(32, 0x43);
+        bool threw = false;
+        try {
+            PrimePool pool(wrong);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw && "Expected authentication failure with wrong key");
+    }
+    std::remove(path.c_str());
+    std::cout << "[PASS] sifrovano cuvanje\n";
+}
+
+int main() {
+    try {
+        test_refill_and_take();
+        test_generate_keys_uses_pool();
+        test_persistence();
+        std::cout << "[ALL TESTS PASSED]\n";
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "[TEST FAILED] Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
@@ -41,6 +41,20 @@ static void run_round_trip_tests_for_key(int bits) {
         std::cout << "[PASS] bits=" << bits << " len(msg)=" << msg.size() << "\n";
     }
 
+    // Serije: isti rezultat kao pojedinačni pozivi (multi-buffer modexp)
+    std::vector<std::vector<std::uint8_t>> encs;
+    for (const auto& msg : messages) encs.push_back(RSA::encrypt(std::vector<std::uint8_t>(msg.begin(), msg.end()), keys.public_key));
+    auto decs = RSA::decrypt_batch(encs, keys.private_key);
+    auto sigs = RSA::sign_batch(messages, keys.private_key);
+    assert(decs.size() == messages.size() && sigs.size() == messages.size());
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        assert(decs[i] == RSA::decrypt(encs[i], keys.private_key));
+        assert(sigs[i] == RSA::sign(messages[i], keys.private_key));
+        assert(RSA::verify(messages[i], sigs[i], keys.public_key));
+    }
+    assert(RSA::decrypt_batch({}, keys.private_key).empty());
+    std::cout << "[PASS] bits=" << bits << " decrypt_batch/sign_batch\n";
+
     // Negativni test: poruka veća od limita treba da baci izuzetak
     std::string tooLong;
     tooLong.resize(maxMsg + 1, 'B');
@@ -57,7 +71,7 @@ static void run_round_trip_tests_for_key(int bits) {
 int main() {
     try {
         // Testiraj različite veličine ključeva
-        std::vector<int> keySizes = {1024, 2048};
+        std::vector<int> keySizes = {1024, 2048, 3072, 4096, 8192};
         for (int bits : keySizes) {
             run_round_trip_tests_for_key(bits);
         }
@@ -0,0 +1,159 @@
+#include "session.hpp"
+#include "rsa.hpp"
+#include "aead.hpp"
+#include "random_utils.hpp"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <stdexcept>
+#include <cassert>
+
+using namespace CryptoLib;
+using namespace std::chrono;
+
+template <class F>
+static bool throws_runtime(F f) {
+    try {
+        f();
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+static void test_roundtrip(const RSAKeyPair& kp) {
+    SessionSender tx(kp.public_key);
+    SessionReceiver rx(kp.private_key, tx.encapsulated_key());
+
+    for (std::size_t len : { 0, 1, 15, 16, 17, 190, 191, 4096, 1 << 20 }) {
+        std::vector<std::uint8_t> msg(len);
+        for (std::size_t i = 0; i < len; ++i) msg[i] = static_cast<std::uint8_t>(i * 31 + 7);
+        const std::vector<std::uint8_t> aad = { 'h', 'd', 'r' };
+        auto sealed = tx.seal(msg, aad);
+        assert(sealed.size() == session_header_size + len + Aes256Gcm::tag_size);
+        assert(rx.open(sealed, aad) == msg);
+    }
+    assert(rx.open_string(tx.seal_string("zdravo")) == "zdravo");
+    std::cout << "[PASS] roundtrip, poruke do 1 MiB (RSA limit je " << 128 - 66 << " bajtova)\n";
+}
+
+static void test_rejections(const RSAKeyPair& kp) {
+    SessionSender tx(kp.public_key);
+    SessionReceiver rx(kp.private_key, tx.encapsulated_key());
+
+    auto m0 = tx.seal_string("prva");
+    auto m1 = tx.seal_string("druga");
+    auto m2 = tx.seal_string("treca");
+
+    // Izmenjen ciphertext, pogrešan AAD
+    auto bad = m0;
+    bad[session_header_size] ^= 0x01;
+    assert(throws_runtime([&] { rx.open(bad); }));
+    assert(throws_runtime([&] { rx.open(m0, { 'x' }); }));
+
+    // Izgubljena poruka se preskače, ponovljena ili zakasnela odbija
+    assert(rx.open_string(m1) == "druga");
+    assert(throws_runtime([&] { rx.open(m1); }));
+    assert(throws_runtime([&] { rx.open(m0); }));
+    assert(rx.open_string(m2) == "treca");
+
+    // Izmenjen brojač u zaglavlju menja nonce -> tag ne prolazi
+    auto m3 = tx.seal_string("cetvrta");
+    auto forged = m3;
+    forged[session_header_size - 1] ^= 0x01;
+    assert(throws_runtime([&] { rx.open(forged); }));
+    assert(rx.open_string(m3) == "cetvrta");
+    std::cout << "[PASS] tamper / replay / reorder odbijeni\n";
+}
+
+static void test_rekey_limits(const RSAKeyPair& kp) {
+    SessionLimits limits;
+    limits.max_messages = 3;
+    limits.max_bytes = 100;
+    SessionSender tx(kp.public_key, limits);
+    SessionReceiver rx(kp.private_key, tx.encapsulated_key(), limits);
+
+    for (int i = 0; i < 3; ++i) assert(rx.open_string(tx.seal_string("m")) == "m");
+    assert(tx.needs_rekey());
+    assert(throws_runtime([&] { tx.seal_string("m"); }));
+
+    const auto old_key = tx.encapsulated_key();
+    rx.rekey(tx.rekey());
+    assert(tx.epoch() == 1 && rx.epoch() == 1);
+    assert(rx.open_string(tx.seal_string("posle")) == "posle");
+
+    // Stari ključ se ne prihvata ponovo, poruke stare epohe se odbijaju
+    assert(throws_runtime([&] { rx.rekey(old_key); }));
+
+    // Ograničenje bajtova
+    assert(throws_runtime([&] { tx.seal(std::vector<std::uint8_t>(101)); }));
+    assert(rx.open(tx.seal(std::vector<std::uint8_t>(90))).size() == 90);
+    assert(tx.needs_rekey(11) && !tx.needs_rekey(5));
+    std::cout << "[PASS] rekey ograničenja\n";
+}
+
+// Jedan Aes256Gcm iz više niti: svaka šifruje svojom kopijom ključa, rezultati se ne mešaju
+static void test_shared_aead() {
+    std::vector<std::uint8_t> key(Aes256Gcm::key_size);
+    csprng_bytes(key);
+    const Aes256Gcm aead(key);
+
+    std::atomic<int> failures{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 500; ++i) {
+                std::vector<std::uint8_t> nonce(Aes256Gcm::nonce_size, 0);
+                nonce[0] = static_cast<std::uint8_t>(t);
+                nonce[1] = static_cast<std::uint8_t>(i);
+                nonce[2] = static_cast<std::uint8_t>(i >> 8);
+                const std::vector<std::uint8_t> msg(1 + i % 200, static_cast<std::uint8_t>(t));
+                const auto sealed = aead.seal(nonce, nonce, msg);
+                if (aead.open(nonce, nonce, sealed) != msg) ++failures;
+                auto bad = sealed;
+                bad.back() ^= 1;
+                if (!throws_runtime([&] { aead.open(nonce, nonce, bad); })) ++failures;
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    assert(failures == 0);
+    std::cout << "[PASS] deljen Aes256Gcm iz više niti\n";
+}
+
+static void test_throughput(const RSAKeyPair& kp) {
+    const int N = 2000;
+    const std::string msg(100, 'a');
+
+    auto t0 = steady_clock::now();
+    for (int i = 0; i < 20; ++i) RSA::decrypt_to_string(RSA::encrypt_string(msg, kp.public_key), kp.private_key);
+    const double rsa_us = duration<double, std::micro>(steady_clock::now() - t0).count() / 20;
+
+    t0 = steady_clock::now();
+    SessionSender tx(kp.public_key);
+    SessionReceiver rx(kp.private_key, tx.encapsulated_key());
+    for (int i = 0; i < N; ++i) rx.open_string(tx.seal_string(msg));
+    const double session_us = duration<double, std::micro>(steady_clock::now() - t0).count() / N;
+
+    std::cout << "[INFO] 100 B poruka: RSA-OAEP " << rsa_us << " us, sesija " << session_us
+              << " us (uključuje uspostavu)\n";
+}
+
+int main() {
+    try {
+        RSAKeyPair kp1024 = RSA::generate_keys(1024);
+        RSAKeyPair kp2048 = RSA::generate_keys(2048);
+        test_roundtrip(kp1024);
+        test_rejections(kp2048);
+        test_rekey_limits(kp1024);
+        test_shared_aead();
+        test_throughput(kp2048);
+        std::cout << "[ALL TESTS PASSED]\n";
+        return 0;
+    } catch (const std::exception& ex) {
+        std::cerr << "[TEST FAILED] Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}